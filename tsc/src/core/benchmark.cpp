@@ -0,0 +1,449 @@
+/***************************************************************************
+ * benchmark.cpp  -  collision and movement benchmark
+ *
+ * Copyright © 2013 - 2014 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../core/benchmark.hpp"
+#include "../core/game_core.hpp"
+#include "../core/framerate.hpp"
+#include "../core/camera.hpp"
+#include "../core/i18n.hpp"
+#include "../core/sprite_manager.hpp"
+#include "../core/math/utilities.hpp"
+#include "../core/property_helper.hpp"
+#include "../core/filesystem/filesystem.hpp"
+#include "../core/filesystem/resource_manager.hpp"
+#include "../core/filesystem/package_manager.hpp"
+#include "../level/level.hpp"
+#include "../level/level_manager.hpp"
+#include "../level/level_player.hpp"
+#include "../level/level_editor.hpp"
+#include "../gui/hud.hpp"
+#include "../user/preferences.hpp"
+#include "../audio/audio.hpp"
+#include "../audio/sound_manager.hpp"
+#include "../video/video.hpp"
+#include "../video/font.hpp"
+#include "../video/renderer.hpp"
+#include "../video/img_manager.hpp"
+#include "../video/img_settings.hpp"
+#include "../input/mouse.hpp"
+#include "../input/keyboard.hpp"
+#include "../input/joystick.hpp"
+
+using namespace std;
+
+namespace fs = boost::filesystem;
+
+namespace TSC {
+
+/* *** *** *** *** *** *** *** cBenchmark_Timer *** *** *** *** *** *** *** *** *** *** */
+
+void cBenchmark_Timer::Print(unsigned int frames) const
+{
+    const double calls_per_second = m_time > 0.0 ? m_calls / (m_time / 1000000.0) : 0.0;
+
+    cout << "  " << std::left << std::setw(24) << m_name << std::right
+         << std::setw(10) << m_calls << " calls "
+         << std::fixed << std::setprecision(3)
+         << std::setw(12) << m_time / 1000.0 << " ms "
+         << std::setw(10) << m_time / frames << " us/frame "
+         << std::setprecision(0) << std::setw(12) << calls_per_second << " calls/s" << endl;
+}
+
+/* *** *** *** *** *** *** *** cBenchmark_Settings *** *** *** *** *** *** *** *** *** *** */
+
+cBenchmark_Settings::cBenchmark_Settings(void)
+{
+    m_frames = benchmark_default_frames;
+    m_swept_collision = -1;
+    m_broad_phase = -1;
+}
+
+/* *** *** *** *** *** *** *** functions *** *** *** *** *** *** *** *** *** *** */
+
+cBenchmark_Timer* pBenchmark_Colliding_Objects = NULL;
+cBenchmark_Timer* pBenchmark_Collision_Check = NULL;
+cBenchmark_Timer* pBenchmark_Col_Move = NULL;
+
+// Return the number of active sprites which are not destroyed
+static unsigned int Get_Benchmark_Sprite_Count(const cSprite_Manager* sprite_manager)
+{
+    unsigned int count = 0;
+
+    for (cSprite_List::const_iterator itr = sprite_manager->objects.begin(); itr != sprite_manager->objects.end(); ++itr) {
+        const cSprite* obj = (*itr);
+
+        if (!obj->m_active || obj->m_auto_destroy) {
+            continue;
+        }
+
+        count++;
+    }
+
+    return count;
+}
+
+// Return the rightmost start position of the level sprites
+static float Get_Benchmark_Level_End(const cSprite_Manager* sprite_manager)
+{
+    float end_x = 0.0f;
+
+    for (cSprite_List::const_iterator itr = sprite_manager->objects.begin(); itr != sprite_manager->objects.end(); ++itr) {
+        const cSprite* obj = (*itr);
+
+        if (obj->m_auto_destroy) {
+            continue;
+        }
+
+        if (obj->m_start_pos_x + obj->m_start_rect.m_w > end_x) {
+            end_x = obj->m_start_pos_x + obj->m_start_rect.m_w;
+        }
+    }
+
+    return end_x;
+}
+
+// Run the frames in the active level and print the results
+static void Run_Level_Benchmark(const std::string& level_name, unsigned int frames)
+{
+    cSprite_Manager* sprite_manager = pActive_Level->m_sprite_manager;
+
+    cBenchmark_Timer timer_update("Update_Items");
+    cBenchmark_Timer timer_player("Player");
+    cBenchmark_Timer timer_update_late("Update_Items_Late");
+    cBenchmark_Timer timer_handle_collisions("Handle_Collision_Items");
+    // collision functions called in the frame phases
+    cBenchmark_Timer timer_colliding_objects("  Get_Colliding_Objects");
+    cBenchmark_Timer timer_collision_check("  Collision_Check");
+    cBenchmark_Timer timer_col_move("  Col_Move");
+
+    pBenchmark_Colliding_Objects = &timer_colliding_objects;
+    pBenchmark_Collision_Check = &timer_collision_check;
+    pBenchmark_Col_Move = &timer_col_move;
+
+    // same results on every run
+    srand(0);
+    pFramerate->m_speed_factor = 1.0f;
+
+    // scroll the camera from the player start to the end of the level
+    pActive_Camera->Center();
+    const float start_x = pActive_Camera->m_x;
+    const float start_y = pActive_Camera->m_y;
+    const float end_x = Get_Benchmark_Level_End(sprite_manager) - game_res_w * 0.5f;
+
+    // average of the updated sprites
+    unsigned long sprite_count = 0;
+
+    for (unsigned int frame = 0; frame < frames; frame++) {
+        if (end_x > start_x) {
+            pActive_Camera->Set_Pos(start_x + (end_x - start_x) * frame / frames, start_y);
+        }
+
+        const unsigned int frame_sprites = Get_Benchmark_Sprite_Count(sprite_manager);
+        sprite_count += frame_sprites;
+
+        // the order of cLevel_Manager::Update
+        timer_update.Start();
+        sprite_manager->Update_Items();
+        timer_update.Stop(frame_sprites);
+
+        pActive_Level->m_animation_manager->Update();
+
+        timer_player.Start();
+        pLevel_Player->Update();
+        pLevel_Player->Collide_Move();
+        pLevel_Player->Handle_Collisions();
+        timer_player.Stop(1);
+
+        timer_update_late.Start();
+        sprite_manager->Update_Items_Late();
+        timer_update_late.Stop(1);
+
+        timer_handle_collisions.Start();
+        sprite_manager->Handle_Collision_Items();
+        timer_handle_collisions.Stop(1);
+    }
+
+    pBenchmark_Colliding_Objects = NULL;
+    pBenchmark_Collision_Check = NULL;
+    pBenchmark_Col_Move = NULL;
+
+    cout << "Level " << level_name << " : " << sprite_manager->size() << " sprites, " << sprite_count / frames << " active, " << frames << " frames"
+         << ", swept collision " << sprite_manager->m_use_swept_collision << ", broad phase " << sprite_manager->m_use_broad_phase << endl;
+    timer_update.Print(frames);
+    timer_player.Print(frames);
+    timer_update_late.Print(frames);
+    timer_handle_collisions.Print(frames);
+    timer_colliding_objects.Print(frames);
+    timer_collision_check.Print(frames);
+    timer_col_move.Print(frames);
+}
+
+void Init_Benchmark(const std::string& package)
+{
+    // core classes
+    pResource_Manager = new cResource_Manager();
+    pPackage_Manager = new cPackage_Manager();
+    pVideo = new cVideo();
+    // no window
+    pVideo->m_headless = 1;
+    pAudio = new cAudio();
+    pFont = new cFont_Manager();
+    pFramerate = new cFramerate();
+    pRenderer = new cRenderQueue(200);
+    pRenderer_current = new cRenderQueue(200);
+    pImage_Manager = new cImage_Manager();
+    pSound_Manager = new cSound_Manager();
+    pSettingsParser = new cImage_Settings_Parser();
+
+    pPreferences = cPreferences::Load_From_File(pResource_Manager->Get_Preferences_File());
+    I18N_Set_Language(pPreferences->m_language);
+    I18N_Init();
+    pResource_Manager->Init_User_Directory();
+
+    if (!package.empty()) {
+        pPackage_Manager->Set_Current_Package(package);
+    }
+    else {
+        pPackage_Manager->Set_Current_Package(pPreferences->m_package);
+    }
+
+    // audio stays uninitialized and sounds are ignored
+    pVideo->Init_SDL();
+    pFont->Init();
+    pFramerate->Init();
+
+    pLevel_Player = new cLevel_Player(NULL);
+    pLevel_Player->m_disallow_managed_delete = 1;
+    pActive_Player = pLevel_Player;
+
+    pLevel_Manager = new cLevel_Manager();
+    pActive_Animation_Manager = pActive_Level->m_animation_manager;
+    pLevel_Player->Set_Sprite_Manager(pActive_Level->m_sprite_manager);
+
+    pSettingsParser->Preload(pResource_Manager->Get_Game_Pixmaps_Directory());
+
+    // the gameplay code expects these but the editor and the menus are never shown
+    pHud_Manager = new cHud_Manager(pActive_Level->m_sprite_manager);
+    pLevel_Player->Init();
+    pLevel_Editor = new cEditor_Level(pActive_Level->m_sprite_manager, pActive_Level);
+    pMouseCursor = new cMouseCursor(pActive_Level->m_sprite_manager);
+    pKeyboard = new cKeyboard();
+    pJoystick = new cJoystick();
+    pLevel_Manager->Init();
+    pHud_Manager->Load();
+}
+
+void Exit_Benchmark(void)
+{
+    pVideo->Stop_Async_Surfaces();
+
+    pLevel_Manager->Unload();
+
+    delete pAudio;
+    pAudio = NULL;
+    delete pLevel_Player;
+    pLevel_Player = NULL;
+    delete pHud_Manager;
+    pHud_Manager = NULL;
+    delete pSound_Manager;
+    pSound_Manager = NULL;
+    delete pLevel_Editor;
+    pLevel_Editor = NULL;
+    // the preferences are not saved
+    delete pPreferences;
+    pPreferences = NULL;
+    delete pMouseCursor;
+    pMouseCursor = NULL;
+    delete pJoystick;
+    pJoystick = NULL;
+    delete pKeyboard;
+    pKeyboard = NULL;
+    delete pLevel_Manager;
+    pLevel_Manager = NULL;
+    delete pRenderer;
+    pRenderer = NULL;
+    delete pRenderer_current;
+    pRenderer_current = NULL;
+    delete pVideo;
+    pVideo = NULL;
+    delete pImage_Manager;
+    pImage_Manager = NULL;
+    delete pSettingsParser;
+    pSettingsParser = NULL;
+    delete pFont;
+    pFont = NULL;
+    delete pPackage_Manager;
+    pPackage_Manager = NULL;
+    delete pResource_Manager;
+    pResource_Manager = NULL;
+
+    IMG_Quit();
+    SDL_Quit();
+}
+
+bool Run_Collision_Benchmark(vector<std::string> levels, const cBenchmark_Settings& settings)
+{
+    const unsigned int frames = settings.m_frames ? settings.m_frames : 1;
+
+    // all game levels
+    if (levels.empty()) {
+        vector<fs::path> files = Get_Directory_Files(pPackage_Manager->Get_Game_Level_Path(), ".tsclvl", false, false);
+        std::sort(files.begin(), files.end());
+
+        for (vector<fs::path>::const_iterator itr = files.begin(); itr != files.end(); ++itr) {
+            levels.push_back(path_to_utf8(itr->stem()));
+        }
+    }
+
+    bool success = 1;
+
+    for (vector<std::string>::const_iterator itr = levels.begin(); itr != levels.end(); ++itr) {
+        cLevel* level = pLevel_Manager->Load(*itr);
+
+        if (!level) {
+            cerr << "Error : Benchmark level not found " << *itr << endl;
+            success = 0;
+            continue;
+        }
+
+        pLevel_Manager->Set_Active(level);
+        level->Init();
+
+        // enter the level without cLevel::Enter as it needs the editor gui
+        Game_Mode = MODE_LEVEL;
+        level->Set_Sprite_Manager();
+        pActive_Camera = pLevel_Manager->m_camera;
+        pActive_Player = pLevel_Player;
+        pActive_Animation_Manager = level->m_animation_manager;
+        // nothing should end the level early
+        pLevel_Player->m_god_mode = 1;
+
+        if (settings.m_swept_collision >= 0) {
+            level->m_sprite_manager->m_use_swept_collision = settings.m_swept_collision > 0;
+        }
+        if (settings.m_broad_phase >= 0) {
+            level->m_sprite_manager->m_use_broad_phase = settings.m_broad_phase > 0;
+        }
+
+        Run_Level_Benchmark(*itr, frames);
+
+        // free the previous levels
+        Game_Mode = MODE_NOTHING;
+        pLevel_Manager->Unload();
+    }
+
+    return success;
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#ifdef TSC_BENCHMARK
+
+using namespace TSC;
+
+// SDLmain defines this for Win32 applications but under debug we use the console
+#if defined( __WIN32__ ) && defined( _DEBUG )
+#undef main
+#endif
+
+// Return the switch value or -1 if invalid
+static int Get_Benchmark_Switch(const std::string& value)
+{
+    if (value == "1" || value == "on") {
+        return 1;
+    }
+    else if (value == "0" || value == "off") {
+        return 0;
+    }
+
+    return -1;
+}
+
+int main(int argc, char** argv)
+{
+    vector<std::string> arguments(argv, argv + argc);
+    vector<std::string> levels;
+    std::string package;
+    cBenchmark_Settings settings;
+
+    for (unsigned int i = 1; i < arguments.size(); i++) {
+        // help
+        if (arguments[i] == "--help" || arguments[i] == "-h") {
+            cout << "Usage: " << arguments[0] << " [OPTIONS] [LEVEL...]" << endl;
+            cout << "Times the level updates and collisions in the given or all game levels without a window" << endl;
+            cout << "Where OPTIONS is one of the following:" << endl;
+            cout << "-h, --help\t\tDisplay this message" << endl;
+            cout << "-f, --frames\t\tFrames run in every level, default " << benchmark_default_frames << endl;
+            cout << "-s, --swept-collision\tSwept collision on or off, default is the preference" << endl;
+            cout << "-b, --broad-phase\tBroad phase on or off, default is on" << endl;
+            cout << "-p, --package\t\tLoad the levels of the given package" << endl;
+            return EXIT_SUCCESS;
+        }
+        // options with a value
+        else if (arguments[i].substr(0, 1) == "-") {
+            if (i + 1 >= arguments.size()) {
+                cerr << arguments[i] << " requires a value" << endl;
+                return EXIT_FAILURE;
+            }
+
+            const std::string& option = arguments[i];
+            const std::string& value = arguments[++i];
+
+            if (option == "--frames" || option == "-f") {
+                if (!Is_Valid_Number(value, 0)) {
+                    cerr << "Invalid frame count " << value << endl;
+                    return EXIT_FAILURE;
+                }
+
+                settings.m_frames = string_to_int(value);
+            }
+            else if (option == "--swept-collision" || option == "-s" || option == "--broad-phase" || option == "-b") {
+                const int state = Get_Benchmark_Switch(value);
+
+                if (state < 0) {
+                    cerr << option << " requires on or off" << endl;
+                    return EXIT_FAILURE;
+                }
+
+                if (option == "--swept-collision" || option == "-s") {
+                    settings.m_swept_collision = state;
+                }
+                else {
+                    settings.m_broad_phase = state;
+                }
+            }
+            else if (option == "--package" || option == "-p") {
+                package = value;
+            }
+            else {
+                cerr << "Unknown argument " << option << endl << "Use -h to list all possible arguments" << endl;
+                return EXIT_FAILURE;
+            }
+        }
+        else {
+            levels.push_back(arguments[i]);
+        }
+    }
+
+    Init_Benchmark(package);
+    const bool success = Run_Collision_Benchmark(levels, settings);
+    Exit_Benchmark();
+
+    return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+#endif
@@ -0,0 +1,140 @@
+/***************************************************************************
+ * benchmark.h  -  collision and movement benchmark
+ *
+ * Copyright © 2013 - 2014 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_BENCHMARK_HPP
+#define TSC_BENCHMARK_HPP
+
+#include "../core/global_basic.hpp"
+
+namespace TSC {
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+    // default number of frames run in every level
+    static const unsigned int benchmark_default_frames = 1000;
+
+    /* *** *** *** *** *** *** *** cBenchmark_Timer *** *** *** *** *** *** *** *** *** *** */
+
+    // summed up duration of the calls of one operation
+    class cBenchmark_Timer {
+    public:
+        cBenchmark_Timer(const std::string& name)
+            : m_name(name), m_calls(0), m_time(0.0), m_depth(0) {}
+
+        void Start(void)
+        {
+            m_start = boost::chrono::high_resolution_clock::now();
+        }
+
+        void Stop(unsigned int calls)
+        {
+            boost::chrono::duration<double, boost::micro> duration = boost::chrono::high_resolution_clock::now() - m_start;
+            m_time += duration.count();
+            m_calls += calls;
+        }
+
+        // Print the total time and calls per second
+        void Print(unsigned int frames) const;
+
+        std::string m_name;
+        unsigned long m_calls;
+        // microseconds
+        double m_time;
+        // open cBenchmark_Scope count
+        unsigned int m_depth;
+
+    private:
+        boost::chrono::high_resolution_clock::time_point m_start;
+    };
+
+    /* *** *** *** *** *** *** *** cBenchmark_Scope *** *** *** *** *** *** *** *** *** *** */
+
+    /* Times the enclosing function with the given timer if it is set
+     * recursive calls are only counted once
+    */
+    class cBenchmark_Scope {
+    public:
+        cBenchmark_Scope(cBenchmark_Timer* timer)
+            : m_timer(timer)
+        {
+            if (m_timer && !m_timer->m_depth++) {
+                m_timer->Start();
+            }
+        }
+
+        ~cBenchmark_Scope(void)
+        {
+            if (m_timer && !--m_timer->m_depth) {
+                m_timer->Stop(1);
+            }
+        }
+
+    private:
+        cBenchmark_Timer* m_timer;
+    };
+
+    /* Time the enclosing collision function in the benchmark frames
+     * only the tsc_bench executable is built with it
+    */
+#ifdef TSC_BENCHMARK
+#define TSC_BENCHMARK_SCOPE(timer) cBenchmark_Scope benchmark_scope(timer)
+#else
+#define TSC_BENCHMARK_SCOPE(timer)
+#endif
+
+    /* *** *** *** *** *** *** *** cBenchmark_Settings *** *** *** *** *** *** *** *** *** *** */
+
+    class cBenchmark_Settings {
+    public:
+        cBenchmark_Settings(void);
+
+        // frames run in every level
+        unsigned int m_frames;
+        /* overrides cSprite_Manager::m_use_swept_collision and m_use_broad_phase
+         * -1 keeps the level setting
+        */
+        int m_swept_collision;
+        int m_broad_phase;
+    };
+
+    /* *** *** *** *** *** *** *** functions *** *** *** *** *** *** *** *** *** *** */
+
+    /* Timers of the collision functions, only set while running the benchmark frames
+     * the times include the nested calls of the other functions
+    */
+    extern cBenchmark_Timer* pBenchmark_Colliding_Objects;
+    extern cBenchmark_Timer* pBenchmark_Collision_Check;
+    extern cBenchmark_Timer* pBenchmark_Col_Move;
+
+    /* Initialize the game classes needed to run levels without a window
+     * package : if not empty it is used instead of the preferences package
+    */
+    void Init_Benchmark(const std::string& package);
+    // Delete the classes created by Init_Benchmark
+    void Exit_Benchmark(void);
+
+    /* Load the given levels and time the level updates and collisions over the given number of frames
+     * Nothing is drawn, the camera scrolls through the level and the frames use a fixed speedfactor and random seed.
+     * The results of every level are printed to stdout.
+     * levels : level names, if empty all game levels are used
+     * Returns false if a level could not be loaded.
+    */
+    bool Run_Collision_Benchmark(std::vector<std::string> levels, const cBenchmark_Settings& settings);
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
@@ -0,0 +1,295 @@
+/***************************************************************************
+ * broad_phase.cpp  -  per frame sweep and prune collision broad phase
+ *
+ * Copyright © 2013 - 2014 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../core/broad_phase.hpp"
+#include "../core/framerate.hpp"
+#include "../objects/movingsprite.hpp"
+
+using namespace std;
+
+namespace TSC {
+
+/* *** *** *** *** *** *** cBroad_Phase *** *** *** *** *** *** *** *** *** *** *** */
+
+// extra space around the swept rects for float inaccuracies
+static const float broad_phase_margin = 1.0f;
+
+cBroad_Phase* cBroad_Phase::m_active = NULL;
+unsigned int cBroad_Phase::m_frame_counter = 0;
+
+// sort items by their left border
+struct broad_phase_item_sort {
+    template<class T> bool operator()(const T& a, const T& b) const
+    {
+        return a.m_rect.m_x < b.m_rect.m_x;
+    }
+};
+
+cBroad_Phase::cBroad_Phase(void)
+{
+    m_frame = 0;
+    m_valid = 0;
+}
+
+cBroad_Phase::~cBroad_Phase(void)
+{
+    Clear();
+}
+
+void cBroad_Phase::Build(const cSprite_List& objects, cSprite* player, const cSprite_Grid* static_grid /* = NULL */)
+{
+    m_frame_counter++;
+
+    // 0 is used for sprites which were never added
+    if (!m_frame_counter) {
+        m_frame_counter++;
+    }
+
+    m_frame = m_frame_counter;
+    m_valid = 1;
+    m_active = this;
+
+    m_items.clear();
+    m_active_moving.clear();
+    m_active_static.clear();
+
+    unsigned int list_count = 0;
+
+    for (cSprite_List::const_iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+        cSprite* obj = (*itr);
+
+        if (obj->m_auto_destroy) {
+            continue;
+        }
+
+        cItem item;
+        item.m_sprite = obj;
+        item.m_rect = obj->m_col_rect;
+        item.m_list = -1;
+
+        cMovingSprite* moving_obj = dynamic_cast<cMovingSprite*>(obj);
+
+        // swept rect of the movement in cMovingSprite::Collide_Move
+        if (moving_obj && moving_obj->m_valid_update && moving_obj->Is_In_Range()) {
+            float move_x = moving_obj->m_velx;
+            float move_y = moving_obj->m_vely;
+
+            // also moved with the ground
+            cMovingSprite* moving_ground = dynamic_cast<cMovingSprite*>(moving_obj->m_ground_object);
+
+            if (moving_ground) {
+                move_x += moving_ground->m_velx;
+                move_y += moving_ground->m_vely;
+            }
+
+            move_x *= pFramerate->m_speed_factor;
+            move_y *= pFramerate->m_speed_factor;
+
+            if (move_x > 0.0f) {
+                item.m_rect.m_w += move_x;
+            }
+            else {
+                item.m_rect.m_x += move_x;
+                item.m_rect.m_w -= move_x;
+            }
+
+            if (move_y > 0.0f) {
+                item.m_rect.m_h += move_y;
+            }
+            else {
+                item.m_rect.m_y += move_y;
+                item.m_rect.m_h -= move_y;
+            }
+
+            item.m_list = list_count;
+            list_count++;
+        }
+
+        m_items.push_back(item);
+    }
+
+    if (player) {
+        cItem item;
+        item.m_sprite = player;
+        item.m_rect = player->m_col_rect;
+        item.m_list = -1;
+        m_items.push_back(item);
+    }
+
+    // reuse the lists
+    if (m_lists.size() < list_count) {
+        m_lists.resize(list_count);
+    }
+
+    for (unsigned int i = 0; i < list_count; i++) {
+        m_lists[i].clear();
+    }
+
+    // sweep on the x axis
+    std::stable_sort(m_items.begin(), m_items.end(), broad_phase_item_sort());
+
+    for (unsigned int i = 0; i < m_items.size(); i++) {
+        cItem& item = m_items[i];
+
+        item.m_rect.m_x -= broad_phase_margin;
+        item.m_rect.m_y -= broad_phase_margin;
+        item.m_rect.m_w += broad_phase_margin * 2.0f;
+        item.m_rect.m_h += broad_phase_margin * 2.0f;
+
+        item.m_sprite->m_broad_phase_entry.m_frame = m_frame;
+        item.m_sprite->m_broad_phase_entry.m_index = i;
+
+        Prune(m_active_moving, item.m_rect.m_x);
+        Prune(m_active_static, item.m_rect.m_x);
+
+        // moving items collide with everything
+        for (vector<unsigned int>::const_iterator itr = m_active_moving.begin(); itr != m_active_moving.end(); ++itr) {
+            cItem& other = m_items[*itr];
+
+            if (!item.m_rect.Intersects(other.m_rect)) {
+                continue;
+            }
+
+            m_lists[other.m_list].push_back(item.m_sprite);
+
+            if (item.m_list >= 0) {
+                m_lists[item.m_list].push_back(other.m_sprite);
+            }
+        }
+
+        // static items only with moving ones
+        if (item.m_list >= 0) {
+            for (vector<unsigned int>::const_iterator itr = m_active_static.begin(); itr != m_active_static.end(); ++itr) {
+                cItem& other = m_items[*itr];
+
+                if (!item.m_rect.Intersects(other.m_rect)) {
+                    continue;
+                }
+
+                m_lists[item.m_list].push_back(other.m_sprite);
+            }
+
+            m_active_moving.push_back(i);
+        }
+        else {
+            m_active_static.push_back(i);
+        }
+    }
+
+    if (!static_grid) {
+        return;
+    }
+
+    // static sprites never move and are not part of the sweep
+    for (Item_List::const_iterator itr = m_items.begin(); itr != m_items.end(); ++itr) {
+        const cItem& item = (*itr);
+
+        if (item.m_list < 0) {
+            continue;
+        }
+
+        m_static_candidates.clear();
+        static_grid->Get_Candidates(m_static_candidates, item.m_rect);
+
+        for (cSprite_List::const_iterator sitr = m_static_candidates.begin(); sitr != m_static_candidates.end(); ++sitr) {
+            cSprite* obj = (*sitr);
+
+            if (obj->m_auto_destroy || !item.m_rect.Intersects(obj->m_col_rect)) {
+                continue;
+            }
+
+            m_lists[item.m_list].push_back(obj);
+        }
+    }
+}
+
+void cBroad_Phase::Clear(void)
+{
+    m_valid = 0;
+
+    if (m_active == this) {
+        m_active = NULL;
+    }
+}
+
+void cBroad_Phase::Invalidate(void)
+{
+    m_valid = 0;
+}
+
+const cSprite_List* cBroad_Phase::Get_Candidates(const cSprite* sprite, const GL_rect& rect) const
+{
+    if (!sprite || !Is_Valid_Entry(sprite->m_broad_phase_entry)) {
+        return NULL;
+    }
+
+    const cItem& item = m_items[sprite->m_broad_phase_entry.m_index];
+
+    // not moving or another sprite
+    if (item.m_list < 0 || item.m_sprite != sprite) {
+        return NULL;
+    }
+
+    // outside of the swept rect
+    if (rect.m_x < item.m_rect.m_x || rect.m_y < item.m_rect.m_y ||
+        rect.m_x + rect.m_w > item.m_rect.m_x + item.m_rect.m_w || rect.m_y + rect.m_h > item.m_rect.m_y + item.m_rect.m_h) {
+        return NULL;
+    }
+
+    return &m_lists[item.m_list];
+}
+
+void cBroad_Phase::Update(const cSprite* sprite)
+{
+    if (!Is_Valid_Entry(sprite->m_broad_phase_entry)) {
+        return;
+    }
+
+    const cItem& item = m_items[sprite->m_broad_phase_entry.m_index];
+    const GL_rect& rect = sprite->m_col_rect;
+
+    // left the swept rect
+    if (rect.m_x < item.m_rect.m_x || rect.m_y < item.m_rect.m_y ||
+        rect.m_x + rect.m_w > item.m_rect.m_x + item.m_rect.m_w || rect.m_y + rect.m_h > item.m_rect.m_y + item.m_rect.m_h) {
+        Invalidate();
+    }
+}
+
+void cBroad_Phase::Remove(const cSprite* sprite)
+{
+    if (Is_Valid_Entry(sprite->m_broad_phase_entry)) {
+        Invalidate();
+    }
+}
+
+void cBroad_Phase::Prune(vector<unsigned int>& active, float pos) const
+{
+    for (unsigned int i = 0; i < active.size();) {
+        const cItem& item = m_items[active[i]];
+
+        // ends before the position
+        if (item.m_rect.m_x + item.m_rect.m_w < pos) {
+            active[i] = active.back();
+            active.pop_back();
+        }
+        else {
+            i++;
+        }
+    }
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
@@ -0,0 +1,113 @@
+/***************************************************************************
+ * broad_phase.h  -  per frame sweep and prune collision broad phase
+ *
+ * Copyright © 2013 - 2014 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_BROAD_PHASE_HPP
+#define TSC_BROAD_PHASE_HPP
+
+#include "../core/global_basic.hpp"
+#include "../core/global_game.hpp"
+#include "../core/math/rect.hpp"
+#include "../core/sprite_grid.hpp"
+
+namespace TSC {
+
+    /* *** *** *** *** *** cBroad_Phase_Entry *** *** *** *** *** *** *** *** *** *** *** *** */
+
+    /* Broad phase bookkeeping stored in every sprite
+     * only valid if the frame matches the active broad phase
+    */
+    struct cBroad_Phase_Entry {
+        cBroad_Phase_Entry(void)
+            : m_frame(0), m_index(0) {};
+
+        // frame this entry was created in
+        unsigned int m_frame;
+        // item number
+        unsigned int m_index;
+    };
+
+    /* *** *** *** *** *** cBroad_Phase *** *** *** *** *** *** *** *** *** *** *** *** */
+
+    /* Sweep and prune over the swept collision rects of one frame
+     * Every moving sprite gets a list of all sprites its swept rect may touch.
+     * If any sprite leaves its swept rect or sprites are added or deleted
+     * the lists become invalid and the queries fall back to the sprite grid.
+    */
+    class cBroad_Phase {
+    public:
+        cBroad_Phase(void);
+        ~cBroad_Phase(void);
+
+        /* Build the candidate lists
+         * objects : all sprites to check
+         * player : also added if set
+         * static_grid : if set its sprites are added to the moving sprite candidates
+        */
+        void Build(const std::vector<cSprite*>& objects, cSprite* player, const cSprite_Grid* static_grid = NULL);
+        // Stop using the candidate lists
+        void Clear(void);
+        // Invalidate the candidate lists until the next build
+        void Invalidate(void);
+
+        /* Return the candidates of the given sprite
+         * returns NULL if not available or the rect is not inside the swept rect
+        */
+        const std::vector<cSprite*>* Get_Candidates(const cSprite* sprite, const GL_rect& rect) const;
+        // Invalidate if the sprite left its swept rect
+        void Update(const cSprite* sprite);
+        // Invalidate if the sprite is part of the broad phase
+        void Remove(const cSprite* sprite);
+
+        // the broad phase currently building or in use
+        static cBroad_Phase* m_active;
+
+    private:
+        struct cItem {
+            cSprite* m_sprite;
+            GL_rect m_rect;
+            // candidate list number or -1 if not moving
+            int m_list;
+        };
+
+        // Return true if the entry is from the current frame
+        bool Is_Valid_Entry(const cBroad_Phase_Entry& entry) const
+        {
+            return m_valid && entry.m_frame == m_frame && entry.m_index < m_items.size();
+        }
+
+        // Remove all items from the active list which end before the given position
+        void Prune(std::vector<unsigned int>& active, float pos) const;
+
+        typedef std::vector<cItem> Item_List;
+        Item_List m_items;
+        std::vector<std::vector<cSprite*> > m_lists;
+        // active sweep items
+        std::vector<unsigned int> m_active_moving;
+        std::vector<unsigned int> m_active_static;
+        // static grid query buffer
+        std::vector<cSprite*> m_static_candidates;
+
+        unsigned int m_frame;
+        bool m_valid;
+
+        // last used frame of all broad phases
+        static unsigned int m_frame_counter;
+    };
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
@@ -106,6 +106,46 @@ cObjectCollision* cObjectCollisionType::Find_First(const SpriteType type)
 
 /* *** *** *** *** *** *** *** cObjectCollision *** *** *** *** *** *** *** *** *** *** */
 
+// number of collisions allocated at once if the free list is empty
+static const unsigned int collision_pool_block_size = 256;
+// unused collision memory
+static vector<void*> collision_free_list;
+
+void* cObjectCollision::operator new(size_t size)
+{
+    // derived classes use the default allocation
+    if (size != sizeof(cObjectCollision)) {
+        return ::operator new(size);
+    }
+
+    if (collision_free_list.empty()) {
+        char* block = static_cast<char*>(::operator new(sizeof(cObjectCollision) * collision_pool_block_size));
+
+        for (unsigned int i = 0; i < collision_pool_block_size; i++) {
+            collision_free_list.push_back(block + (i * sizeof(cObjectCollision)));
+        }
+    }
+
+    void* ptr = collision_free_list.back();
+    collision_free_list.pop_back();
+
+    return ptr;
+}
+
+void cObjectCollision::operator delete(void* ptr, size_t size)
+{
+    if (!ptr) {
+        return;
+    }
+
+    if (size != sizeof(cObjectCollision)) {
+        ::operator delete(ptr);
+        return;
+    }
+
+    collision_free_list.push_back(ptr);
+}
+
 cObjectCollision::cObjectCollision(void)
 {
     m_valid_type = COL_VTYPE_NOT_VALID;
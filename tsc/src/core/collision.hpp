@@ -35,6 +35,12 @@ namespace TSC {
         cObjectCollision(void);
         ~cObjectCollision(void);
 
+        /* Collisions are created and deleted for every movement step
+         * so the memory is reused from a free list
+        */
+        static void* operator new(size_t size);
+        static void operator delete(void* ptr, size_t size);
+
         /* Set the collision direction
          * base - the base sprite
          * col - the colliding sprite
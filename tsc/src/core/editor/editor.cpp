@@ -139,11 +139,27 @@ void cEditor_Item_Object::Init(cSprite* sprite)
     // get scale
     preview_scale = pVideo->Get_Scale(sprite_obj->m_start_image, static_cast<float>(pPreferences->m_editor_item_image_size) * 2.0f, static_cast<float>(pPreferences->m_editor_item_image_size));
 
+    // the preview needs the texture
+    pVideo->Finish_Async_Surface(sprite_obj->m_start_image);
+
+    const cGL_Surface* start_image = sprite_obj->m_start_image;
+    // the texture can be an atlas page
+    const CEGUI::Size texture_size(start_image->m_tex_w / start_image->m_tex_coords.m_w, start_image->m_tex_h / start_image->m_tex_coords.m_h);
+
     // create CEGUI link
-    cEditor_CEGUI_Texture* texture = new cEditor_CEGUI_Texture(*pGuiRenderer, sprite_obj->m_start_image->m_image, CEGUI::Size(sprite_obj->m_start_image->m_tex_w, sprite_obj->m_start_image->m_tex_h));
+    cEditor_CEGUI_Texture* texture = new cEditor_CEGUI_Texture(*pGuiRenderer, start_image->m_image, texture_size);
     CEGUI::String imageset_name = "editor_item " + list_text->getText() + " " + CEGUI::PropertyHelper::uintToString(m_parent->getItemCount());
     m_image = &CEGUI::ImagesetManager::getSingleton().create(imageset_name, *texture);
-    m_image->defineImage("default", CEGUI::Point(0, 0), texture->getSize(), CEGUI::Point(0, 0));
+    m_image->defineImage("default", Get_Image_Area(), CEGUI::Point(0, 0));
+}
+
+CEGUI::Rect cEditor_Item_Object::Get_Image_Area(void) const
+{
+    const cGL_Surface* start_image = sprite_obj->m_start_image;
+    const CEGUI::Size texture_size = m_image->getTexture()->getSize();
+    const CEGUI::Point pos(start_image->m_tex_coords.m_x * texture_size.d_width, start_image->m_tex_coords.m_y * texture_size.d_height);
+
+    return CEGUI::Rect(pos, CEGUI::Size(start_image->m_tex_w, start_image->m_tex_h));
 }
 
 CEGUI::Size cEditor_Item_Object::getPixelSize(void) const
@@ -161,7 +177,7 @@ void cEditor_Item_Object::draw(CEGUI::GeometryBuffer& buffer, const CEGUI::Rect&
 {
     // image
     if (m_image && pPreferences->m_editor_show_item_images) {
-        m_image->draw(buffer, CEGUI::Rect(CEGUI::Point(0, 0), m_image->getTexture()->getSize()), CEGUI::Rect(targetRect.d_left + 15, targetRect.d_top + 22, targetRect.d_left + 15 + (sprite_obj->m_start_image->m_start_w * preview_scale * global_upscalex), targetRect.d_top + 22 + (sprite_obj->m_start_image->m_start_h * preview_scale * global_upscaley)), clipper, CEGUI::ColourRect(CEGUI::colour(1.0f, 1.0f, 1.0f, alpha)), CEGUI::TopLeftToBottomRight);
+        m_image->draw(buffer, Get_Image_Area(), CEGUI::Rect(targetRect.d_left + 15, targetRect.d_top + 22, targetRect.d_left + 15 + (sprite_obj->m_start_image->m_start_w * preview_scale * global_upscalex), targetRect.d_top + 22 + (sprite_obj->m_start_image->m_start_h * preview_scale * global_upscaley)), clipper, CEGUI::ColourRect(CEGUI::colour(1.0f, 1.0f, 1.0f, alpha)), CEGUI::TopLeftToBottomRight);
     }
     // name text
     list_text->draw(buffer, targetRect, alpha, clipper);
@@ -250,12 +266,15 @@ void cEditor::Init(void)
 
 void cEditor::Unload(void)
 {
-    // Unload Items
-    Unload_Item_Menu();
+    // the gui is not initialized in the headless mode
+    if (pGuiSystem) {
+        // Unload Items
+        Unload_Item_Menu();
 
-    // close help window
-    if (CEGUI::WindowManager::getSingleton().isWindowPresent("editor_help_window")) {
-        Window_Help_Exit_Clicked(CEGUI::EventArgs());
+        // close help window
+        if (CEGUI::WindowManager::getSingleton().isWindowPresent("editor_help_window")) {
+            Window_Help_Exit_Clicked(CEGUI::EventArgs());
+        }
     }
 
     // if editor window is loaded
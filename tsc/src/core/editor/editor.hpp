@@ -60,6 +60,9 @@ namespace TSC {
         // Initialize
         void Init(cSprite* sprite);
 
+        // Return the image area on the texture
+        CEGUI::Rect Get_Image_Area(void) const;
+
         // overridden from base class
         virtual CEGUI::Size getPixelSize(void) const;
         // overridden from base class
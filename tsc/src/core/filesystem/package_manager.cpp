@@ -475,10 +475,17 @@ void cPackage_Manager :: Fix_Package_Paths( void )
     }
 }
 
+void cPackage_Manager :: Rescan_Resources(void)
+{
+    // scanned again on the next lookup
+    m_resource_indexes.clear();
+}
+
 void cPackage_Manager :: Build_Search_Path ( void )
 {
     m_search_path.clear();
     m_package_start = 0;
+    m_resource_indexes.clear();
 
     // First add skin package if any
     if(pPreferences && !pPreferences->m_skin.empty()) {
@@ -522,6 +529,45 @@ void cPackage_Manager :: Build_Search_Path_Helper(const std::string& package, st
 
 fs::path cPackage_Manager :: Find_Reading_Path(fs::path dir, fs::path resource, std::vector<std::string> extra_ext)
 {
+    std::string key;
+
+    if (Get_Resource_Key(resource, key)) {
+        const Resource_Index& index = Get_Resource_Index(dir);
+
+        // the first search path with the resource or one of the extensions
+        fs::path found_resource;
+        size_t found_num = m_search_path.size();
+
+        Resource_Index::const_iterator itr = index.find(key);
+        if (itr != index.end()) {
+            found_resource = resource;
+            found_num = itr->second;
+        }
+
+        fs::path ext_resource = resource;
+        for (std::vector<std::string>::const_iterator it_ext = extra_ext.begin(); it_ext != extra_ext.end(); ++it_ext) {
+            ext_resource.replace_extension(*it_ext);
+            Get_Resource_Key(ext_resource, key);
+
+            itr = index.find(key);
+            if (itr != index.end() && itr->second < found_num) {
+                found_resource = ext_resource;
+                found_num = itr->second;
+            }
+        }
+
+        if (found_num < m_search_path.size()) {
+            return m_search_path[found_num] / dir / found_resource;
+        }
+
+        // not found
+        if (m_search_path.empty()) {
+            return fs::path();
+        }
+
+        return m_search_path.back() / dir / ext_resource;
+    }
+
     fs::path path;
     for (std::vector<fs::path>::const_iterator it = m_search_path.begin(); it != m_search_path.end(); ++it) {
         path = *it / dir / resource;
@@ -543,6 +589,74 @@ fs::path cPackage_Manager :: Find_Reading_Path(fs::path dir, fs::path resource,
     return path;
 }
 
+const cPackage_Manager::Resource_Index& cPackage_Manager :: Get_Resource_Index(const fs::path& dir)
+{
+    const std::string dir_name = path_to_utf8(dir);
+    std::map<std::string, Resource_Index>::const_iterator itr = m_resource_indexes.find(dir_name);
+
+    if (itr != m_resource_indexes.end()) {
+        return itr->second;
+    }
+
+    Resource_Index& index = m_resource_indexes[dir_name];
+
+    for (size_t i = 0; i < m_search_path.size(); i++) {
+        const fs::path base = m_search_path[i] / dir;
+        const long base_length = std::distance(base.begin(), base.end());
+        const std::vector<fs::path> files = Get_Directory_Files(base, "", true, true);
+
+        for (std::vector<fs::path>::const_iterator file_itr = files.begin(); file_itr != files.end(); ++file_itr) {
+            // relative to the resource directory
+            fs::path::const_iterator element_itr = file_itr->begin();
+            std::advance(element_itr, base_length);
+
+            fs::path resource;
+            for (; element_itr != file_itr->end(); ++element_itr) {
+                resource /= *element_itr;
+            }
+
+            std::string key;
+            if (Get_Resource_Key(resource, key)) {
+                // an earlier search path is not replaced
+                index.insert(Resource_Index::value_type(key, i));
+            }
+        }
+    }
+
+    return index;
+}
+
+bool cPackage_Manager :: Get_Resource_Key(const fs::path& resource, std::string& key)
+{
+    key.clear();
+
+    if (resource.empty() || resource.has_root_path()) {
+        return false;
+    }
+
+    for (fs::path::const_iterator itr = resource.begin(); itr != resource.end(); ++itr) {
+        const std::string element = path_to_utf8(*itr);
+
+        // only found by the file system
+        if (element.empty() || element == "." || element == "..") {
+            return false;
+        }
+
+        if (!key.empty()) {
+            key += '/';
+        }
+
+        key += element;
+    }
+
+#if defined(_WIN32) || defined(__APPLE__)
+    // the file system is not case sensitive
+    std::transform(key.begin(), key.end(), key.begin(), ::tolower);
+#endif
+
+    return true;
+}
+
 fs::path cPackage_Manager :: Find_Relative_Path(fs::path dir, fs::path path)
 {
     for (std::vector<fs::path>::const_iterator it = m_search_path.begin(); it != m_search_path.end(); ++it) {
@@ -114,8 +114,15 @@ namespace TSC {
         boost::filesystem::path Get_Relative_Sound_Path(boost::filesystem::path path);
         boost::filesystem::path Get_Relative_Music_Path(boost::filesystem::path path);
 
+        /* Scan the resource directories of the search path again
+         * needed if resources were added or removed after the search path was built
+        */
+        void Rescan_Resources(void);
 
     private:
+        // resource names and the first search path position they are found in
+        typedef boost::unordered_map<std::string, size_t> Resource_Index;
+
         void Scan_Packages(boost::filesystem::path base, boost::filesystem::path path, bool user_packages );
         void Load_Package_Info( const boost::filesystem::path& dir, bool user_package );
         void Fix_Package_Paths( void );
@@ -125,10 +132,19 @@ namespace TSC {
         boost::filesystem::path Find_Reading_Path(boost::filesystem::path dir, boost::filesystem::path resource, std::vector<std::string> extra_ext);
         boost::filesystem::path Find_Relative_Path(boost::filesystem::path dir, boost::filesystem::path path);
 
+        // Return the index of the resource directory and scan it if needed
+        const Resource_Index& Get_Resource_Index(const boost::filesystem::path& dir);
+        /* Set the index key of the resource
+         * returns false if the resource can not be found in the index
+        */
+        static bool Get_Resource_Key(const boost::filesystem::path& resource, std::string& key);
+
         std::map <std::string, PackageInfo> m_packages;
         std::string m_current_package;
         std::vector<boost::filesystem::path> m_search_path;
         int m_package_start;
+        // resource directory indexes of the search path
+        std::map<std::string, Resource_Index> m_resource_indexes;
     };
 
     /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
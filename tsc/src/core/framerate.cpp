@@ -70,11 +70,23 @@ cFramerate::cFramerate(void)
     m_fps_average_framedelay = 0;
     m_frames_counted = 0;
     m_last_ticks = 0;
+    m_last_time = boost::chrono::high_resolution_clock::now();
     m_elapsed_ticks = 1;
+    m_elapsed_remainder = 0.0;
     m_max_elapsed_ticks = 100;
     m_speed_factor = 0.1f;
     m_force_speed_factor = 0.0f;
 
+    m_fixed_timestep = 0;
+    // 0 is used for sprites which never saved a step position
+    m_fixed_step = 1;
+    m_interpolation = 1.0f;
+    m_fixed_accumulator = 0.0;
+    m_fixed_remainder = 0.0;
+    m_fixed_ticks = 0;
+    m_frame_speed_factor = m_speed_factor;
+    m_frame_elapsed_ticks = m_elapsed_ticks;
+
     // create performance timers
     for (unsigned int i = 0; i < 24; i++) {
         m_perf_timer.push_back(new cPerformance_Timer());
@@ -103,6 +115,7 @@ void cFramerate::Init(const float target_fps /* = speedfactor_fps */)
 void cFramerate::Update(void)
 {
     const Uint32 current_ticks = SDL_GetTicks();
+    const boost::chrono::high_resolution_clock::time_point current_time = boost::chrono::high_resolution_clock::now();
 
     // if speed factor is forced
     if (!Is_Float_Equal(m_force_speed_factor, 0.0f)) {
@@ -116,20 +129,36 @@ void cFramerate::Update(void)
     }
     // measure speed factor
     else {
-        // set elapsed ticks
-        m_elapsed_ticks = current_ticks - m_last_ticks;
+        boost::chrono::duration<double, boost::milli> elapsed = current_time - m_last_time;
+        double elapsed_ms = elapsed.count();
 
-        // minimum
-        if (m_elapsed_ticks == 0) {
-            m_elapsed_ticks = 1;
+        // minimum to keep the fps finite
+        if (elapsed_ms < 0.1) {
+            elapsed_ms = 0.1;
         }
         // maximum
-        else if (m_elapsed_ticks > m_max_elapsed_ticks) {
-            m_elapsed_ticks = m_max_elapsed_ticks;
+        else if (elapsed_ms > m_max_elapsed_ticks) {
+            elapsed_ms = m_max_elapsed_ticks;
+            m_elapsed_remainder = 0.0;
         }
 
+        // whole milliseconds for the tick counters
+        m_elapsed_remainder += elapsed_ms;
+        m_elapsed_ticks = static_cast<Uint32>(m_elapsed_remainder);
+        m_elapsed_remainder -= m_elapsed_ticks;
+
         // speed factor calculation for this frame
-        m_speed_factor = static_cast<float>(m_elapsed_ticks / (1000 / m_fps_target));
+        m_speed_factor = static_cast<float>(elapsed_ms * m_fps_target / 1000.0);
+
+        // keep the time for the fixed steps
+        if (m_fixed_timestep) {
+            m_fixed_accumulator += elapsed_ms;
+
+            // other loops can call this without updating the steps
+            if (m_fixed_accumulator > m_max_elapsed_ticks) {
+                m_fixed_accumulator = m_max_elapsed_ticks;
+            }
+        }
     }
 
     // speed factor based fps
@@ -157,13 +186,18 @@ void cFramerate::Update(void)
     }
 
     m_last_ticks = current_ticks;
+    m_last_time = current_time;
 }
 
 void cFramerate::Reset(void)
 {
     m_last_ticks = SDL_GetTicks();
+    m_last_time = boost::chrono::high_resolution_clock::now();
     m_elapsed_ticks = 1;
+    m_elapsed_remainder = 0.0;
     m_speed_factor = 0.001f;
+    m_fixed_accumulator = 0.0;
+    m_interpolation = 1.0f;
     m_fps_best = 0;
     m_fps_worst = 100000.0f;
     m_fps_average = 0;
@@ -186,24 +220,142 @@ void cFramerate::Set_Fixed_Speedfacor(const float val)
     m_force_speed_factor = val;
 }
 
+void cFramerate::Set_Fixed_Timestep(bool enable)
+{
+    if (m_fixed_timestep == enable) {
+        return;
+    }
+
+    m_fixed_timestep = enable;
+    m_fixed_accumulator = 0.0;
+    m_fixed_remainder = 0.0;
+    m_interpolation = 1.0f;
+}
+
+unsigned int cFramerate::Get_Fixed_Steps(void)
+{
+    const double step_ms = 1000.0 / m_fps_target;
+
+    // the forced speed factor is the size of one step
+    if (!Is_Float_Equal(m_force_speed_factor, 0.0f)) {
+        m_fixed_accumulator = 0.0;
+        m_interpolation = 1.0f;
+        return 1;
+    }
+
+    const unsigned int steps = static_cast<unsigned int>(m_fixed_accumulator / step_ms);
+
+    m_fixed_accumulator -= steps * step_ms;
+    m_interpolation = static_cast<float>(m_fixed_accumulator / step_ms);
+
+    m_frame_speed_factor = m_speed_factor;
+    m_frame_elapsed_ticks = m_elapsed_ticks;
+
+    return steps;
+}
+
+void cFramerate::Begin_Fixed_Step(void)
+{
+    m_fixed_step++;
+
+    if (!m_fixed_step) {
+        m_fixed_step++;
+    }
+
+    // the forced speed factor is used as is
+    if (!Is_Float_Equal(m_force_speed_factor, 0.0f)) {
+        return;
+    }
+
+    m_speed_factor = 1.0f;
+
+    // whole milliseconds for the tick counters
+    m_fixed_remainder += 1000.0 / m_fps_target;
+    m_elapsed_ticks = static_cast<Uint32>(m_fixed_remainder);
+    m_fixed_remainder -= m_elapsed_ticks;
+
+    /* every step is a new animation frame
+     * always increasing so it never matches a previous frame
+    */
+    m_fixed_ticks = std::max(m_fixed_ticks + 1, SDL_GetTicks());
+    m_last_ticks = m_fixed_ticks;
+}
+
+void cFramerate::End_Fixed_Steps(void)
+{
+    if (!Is_Float_Equal(m_force_speed_factor, 0.0f)) {
+        return;
+    }
+
+    m_speed_factor = m_frame_speed_factor;
+    m_elapsed_ticks = m_frame_elapsed_ticks;
+}
+
 /* *** *** *** *** *** *** *** helper functions *** *** *** *** *** *** *** *** *** *** */
 
+typedef boost::chrono::high_resolution_clock Frame_Clock;
+
+// time the next frame is scheduled for
+static Frame_Clock::time_point frame_time_next;
+/* longest time a 1 millisecond sleep took
+ * the remaining frame time below this is spun as the sleep may take too long
+*/
+static Frame_Clock::duration frame_time_sleep_max = boost::chrono::milliseconds(2);
+
+// Return the duration of one frame
+static Frame_Clock::duration Get_Frame_Duration(const unsigned int fps)
+{
+    return boost::chrono::duration_cast<Frame_Clock::duration>(boost::chrono::duration<double>(1.0 / fps));
+}
+
 void Correct_Frame_Time(const unsigned int fps)
 {
-    while (!Is_Frame_Time(fps)) {
+    if (!fps) {
+        return;
+    }
+
+    // sleep while the next frame is far enough away
+    while (frame_time_next - Frame_Clock::now() > frame_time_sleep_max) {
+        const Frame_Clock::time_point sleep_start = Frame_Clock::now();
         SDL_Delay(1);
+        const Frame_Clock::duration sleep_time = Frame_Clock::now() - sleep_start;
+
+        // never spin longer than a frame
+        if (sleep_time > frame_time_sleep_max && sleep_time < Get_Frame_Duration(fps)) {
+            frame_time_sleep_max = sleep_time;
+        }
+        // slowly forget a single long sleep
+        else if (sleep_time < frame_time_sleep_max && frame_time_sleep_max > boost::chrono::milliseconds(1)) {
+            frame_time_sleep_max -= (frame_time_sleep_max - sleep_time) / 16;
+        }
+    }
+
+    // spin the rest
+    while (!Is_Frame_Time(fps)) {
+        boost::this_thread::yield();
     }
 }
 
 bool Is_Frame_Time(const unsigned int fps)
 {
-    static Uint32 static_time = 0;
+    if (!fps) {
+        return 1;
+    }
+
+    const Frame_Clock::time_point now = Frame_Clock::now();
 
-    if (SDL_GetTicks() - static_time < 1000 / fps) {
+    if (now < frame_time_next) {
         return 0;
     }
 
-    static_time = SDL_GetTicks();
+    const Frame_Clock::duration frame_duration = Get_Frame_Duration(fps);
+
+    // more than a frame late so start again instead of catching up
+    if (now - frame_time_next > frame_duration) {
+        frame_time_next = now;
+    }
+
+    frame_time_next += frame_duration;
     return 1;
 }
 
@@ -45,6 +45,9 @@ namespace TSC {
 
     /* *** *** *** *** *** *** *** cFramerate *** *** *** *** *** *** *** *** *** *** */
 
+    // a fixed step movement larger than this is not interpolated
+    static const float fixed_step_max_interpolation = 100.0f;
+
     /* Framerate class
      * speed factor is a float with that you multiply all your motions. For instance, if the targetfps is 100,
      * and the actual fps is 80, the speed factor will be set to 100/80, or 1.25.
@@ -69,6 +72,19 @@ namespace TSC {
         */
         void Set_Fixed_Speedfacor(const float val);
 
+        /* Set if the game is updated in fixed steps
+         * every step has a speed factor of 1 and the time not yet updated is kept for the next frame
+        */
+        void Set_Fixed_Timestep(bool enable);
+        /* Return the number of fixed steps to update in this frame
+         * and set the interpolation for drawing
+        */
+        unsigned int Get_Fixed_Steps(void);
+        // Set the speed factor and elapsed ticks for the next fixed step
+        void Begin_Fixed_Step(void);
+        // Set the speed factor and elapsed ticks of the frame again
+        void End_Fixed_Steps(void);
+
         // target fps for speed factor calculations
         float m_fps_target;
         // current fps
@@ -85,11 +101,19 @@ namespace TSC {
         unsigned int m_frames_counted;
 
         /* last update ticks
-         * used for speed factor calculation
+         * used to detect a new frame
          */
         Uint32 m_last_ticks;
-        // elapsed ticks since last frame
+        /* last update time
+         * used for speed factor calculation as the ticks are too inaccurate at high framerates
+         */
+        boost::chrono::high_resolution_clock::time_point m_last_time;
+        /* elapsed ticks since last frame
+         * the milliseconds not counted are added to the next frame
+         */
         Uint32 m_elapsed_ticks;
+        // elapsed milliseconds not yet counted in the elapsed ticks
+        double m_elapsed_remainder;
         // maximum elapsed ticks
         Uint32 m_max_elapsed_ticks;
 
@@ -100,6 +124,24 @@ namespace TSC {
         // fixed speed factor value
         float m_force_speed_factor;
 
+        // if the game is updated in fixed steps
+        bool m_fixed_timestep;
+        // number of the current fixed step
+        unsigned int m_fixed_step;
+        /* position between the last fixed step and the next one
+         * from 0 to 1 used to interpolate the drawing
+        */
+        float m_interpolation;
+        // milliseconds not yet updated in fixed steps
+        double m_fixed_accumulator;
+        // elapsed milliseconds of the steps not yet counted in the elapsed ticks
+        double m_fixed_remainder;
+        // last ticks of the last fixed step
+        Uint32 m_fixed_ticks;
+        // frame values while updating the fixed steps
+        float m_frame_speed_factor;
+        Uint32 m_frame_elapsed_ticks;
+
         // ## performance values ##
         // ticks since last section
         Uint32 m_perf_last_ticks;
@@ -112,9 +154,12 @@ namespace TSC {
 
     /* Fixed framerate method
      * if next frame is not ready wait until it is
+     * sleeps most of the time and spins the rest to be accurate
     */
     void Correct_Frame_Time(const unsigned int fps);
-// Return true if the next frame is ready for the given framerate
+    /* Return true if the next frame is ready for the given framerate
+     * frames are scheduled at a fixed interval so the framerate does not drift
+    */
     bool Is_Frame_Time(const unsigned int fps);
 
     /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
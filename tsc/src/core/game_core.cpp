@@ -427,13 +427,16 @@ void Preload_Images(bool draw_gui /* = 0 */)
     unsigned int loaded_files = 0;
     unsigned int file_count = image_files.size();
 
-    // load images
+    // load images in the background
+    vector<cGL_Surface*> images;
+
     for (vector<fs::path>::iterator itr = image_files.begin(); itr != image_files.end(); ++itr) {
-        // get filename
-        fs::path filename = (*itr);
+        images.push_back(pVideo->Get_Surface_Async(*itr));
+    }
 
-        // preload image
-        pVideo->Get_Surface(filename);
+    // wait for the images
+    for (vector<cGL_Surface*>::iterator itr = images.begin(); itr != images.end(); ++itr) {
+        pVideo->Finish_Async_Surface(*itr);
 
         // count files
         loaded_files++;
@@ -22,10 +22,19 @@
 #define _WIN32_IE 0x0500
 #endif
 
-/* uncomment to enable experimental rendering in a thread
-* still randomly crashes because gl functions are called while the render thread is active
+/* uncomment to verify the sprite grid collision queries against a full scan
+* mismatches are printed to stderr
 */
-//#define TSC_RENDER_THREAD_TEST
+//#define TSC_SPRITE_GRID_CHECK
+/* uncomment to verify the swept collision movement against moving in steps
+* different final positions are printed to stderr
+*/
+//#define TSC_SWEPT_COLLISION_CHECK
+/* uncomment to verify that images loaded in the background keep the size
+* of their placeholder when the texture is uploaded
+* differences are printed to stderr
+*/
+//#define TSC_ASYNC_SURFACE_CHECK
 
 /* *** *** *** *** *** *** *** Debugging *** *** *** *** *** *** *** *** *** *** */
 
@@ -76,7 +85,11 @@
 #include <boost/filesystem/fstream.hpp>
 #include <boost/filesystem/convenience.hpp>
 #include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
 #include <boost/chrono.hpp>
+#include <boost/unordered_map.hpp>
+#include <boost/shared_ptr.hpp>
 #include <boost/system/error_code.hpp>
 #include "filesystem/boost_relative.hpp"
 
@@ -84,6 +97,10 @@
 #include <glibmm.h>
 #include <libxml++/libxml++.h>
 
+// GLEW
+// Must be included before any other OpenGL header
+#include <GL/glew.h>
+
 // CEGUI
 // Must be included before SDL/X11, which have #defines such as
 // None, True, and False that screw CEGUI declarations.
@@ -426,10 +426,13 @@ namespace TSC {
     class cSaved_Texture;
     class cSize_Float;
     class cSize_Int;
+    class cSprite_Grid;
     class cSprite_Manager;
     class cSurface_Request;
     class cSprite;
     class cBackground_Manager;
+    class cBroad_Phase;
+    class cStatic_Layer;
     class cWorld_Sprite_Manager;
     class Color;
     class GL_rect;
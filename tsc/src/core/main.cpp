@@ -39,6 +39,8 @@
 #include "../video/renderer.hpp"
 #include "../core/i18n.hpp"
 #include "../gui/generic.hpp"
+#include "../core/camera.hpp"
+#include "../core/sprite_manager.hpp"
 
 using namespace std;
 
@@ -57,6 +59,8 @@ static std::string g_cmdline_package;
 
 /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
 
+// the benchmark executable has its own main in benchmark.cpp
+#ifndef TSC_BENCHMARK
 int main(int argc, char** argv)
 {
 // todo : remove this apple hack
@@ -203,17 +207,25 @@ int main(int argc, char** argv)
 
         // game loop
         while (!game_exit and !game_reset) {
+            pFramerate->Set_Fixed_Timestep(pPreferences->m_fixed_timestep);
+
             // update
             Update_Game();
-            // draw
+
+            // draw at the interpolated camera position
+            float camera_x = 0.0f;
+            float camera_y = 0.0f;
+            cCamera* camera = Set_Step_Camera_Pos(camera_x, camera_y);
+
             Draw_Game();
 
             // render
-#ifdef TSC_RENDER_THREAD_TEST
-            pVideo->Render(1);
-#else
-            pVideo->Render();
-#endif
+            pVideo->Render(pPreferences->m_video_render_thread);
+
+            if (camera) {
+                camera->m_x = camera_x;
+                camera->m_y = camera_y;
+            }
 
             // update speedfactor
             pFramerate->Update();
@@ -228,6 +240,7 @@ int main(int argc, char** argv)
     } while (game_reset);
     return EXIT_SUCCESS;
 }
+#endif
 
 // namespace is set here to exclude main() from it
 namespace TSC {
@@ -301,6 +314,8 @@ void Init_Game(void)
 
     // draw generic loading screen
     Loading_Screen_Init();
+    // parse all image settings at once
+    pSettingsParser->Preload(pResource_Manager->Get_Game_Pixmaps_Directory());
     // initialize image cache
     pVideo->Init_Image_Cache(0, 1);
 
@@ -337,6 +352,11 @@ void Init_Game(void)
 
 void Exit_Game(void)
 {
+    if (pVideo) {
+        pVideo->Stop_Async_Surfaces();
+        pVideo->Stop_Render_Thread();
+    }
+
     if (pPreferences) {
         pPreferences->Save();
     }
@@ -588,6 +608,79 @@ bool Handle_Input_Global(SDL_Event* ev)
     return 0;
 }
 
+// camera position before the last fixed step
+static cCamera* g_step_camera = NULL;
+static float g_step_camera_x = 0.0f;
+static float g_step_camera_y = 0.0f;
+static unsigned int g_step_camera_num = 0;
+
+// Save the positions to interpolate from before a fixed step
+static void Save_Step_Positions(void)
+{
+    if (Game_Mode == MODE_LEVEL) {
+        pActive_Level->m_sprite_manager->Save_Items_Step_Pos();
+        pActive_Level->m_animation_manager->Save_Step_Pos();
+    }
+    else if (Game_Mode == MODE_OVERWORLD) {
+        pActive_Overworld->m_sprite_manager->Save_Items_Step_Pos();
+        pActive_Overworld->m_animation_manager->Save_Step_Pos();
+    }
+    else {
+        g_step_camera = NULL;
+        return;
+    }
+
+    if (pActive_Player) {
+        pActive_Player->Save_Step_Pos();
+    }
+
+    g_step_camera = pActive_Camera;
+    g_step_camera_x = pActive_Camera->m_x;
+    g_step_camera_y = pActive_Camera->m_y;
+    g_step_camera_num = pFramerate->m_fixed_step;
+}
+
+cCamera* Set_Step_Camera_Pos(float& x, float& y)
+{
+    // camera changed or not moved in the last step
+    if (!pFramerate->m_fixed_timestep || !g_step_camera || g_step_camera != pActive_Camera || g_step_camera_num != pFramerate->m_fixed_step) {
+        return NULL;
+    }
+
+    x = pActive_Camera->m_x;
+    y = pActive_Camera->m_y;
+
+    const float step_x = x - g_step_camera_x;
+    const float step_y = y - g_step_camera_y;
+
+    // jumped to another position
+    if (fabs(step_x) > fixed_step_max_interpolation || fabs(step_y) > fixed_step_max_interpolation) {
+        return NULL;
+    }
+
+    pActive_Camera->m_x -= step_x * (1.0f - pFramerate->m_interpolation);
+    pActive_Camera->m_y -= step_y * (1.0f - pFramerate->m_interpolation);
+
+    return pActive_Camera;
+}
+
+// Update the current game mode
+static void Update_Game_Mode(void)
+{
+    if (Game_Mode == MODE_LEVEL) {
+        pLevel_Manager->Update();
+    }
+    else if (Game_Mode == MODE_OVERWORLD) {
+        pActive_Overworld->Update();
+    }
+    else if (Game_Mode == MODE_MENU) {
+        pMenuCore->Update();
+    }
+    else if (Game_Mode == MODE_LEVEL_SETTINGS) {
+        pLevel_Editor->m_settings_screen->Update();
+    }
+}
+
 void Update_Game(void)
 {
     // do not update if exiting
@@ -627,17 +720,19 @@ void Update_Game(void)
     pFramerate->m_perf_last_ticks = SDL_GetTicks();
 
     // ## update
-    if (Game_Mode == MODE_LEVEL) {
-        pLevel_Manager->Update();
-    }
-    else if (Game_Mode == MODE_OVERWORLD) {
-        pActive_Overworld->Update();
-    }
-    else if (Game_Mode == MODE_MENU) {
-        pMenuCore->Update();
+    if (pFramerate->m_fixed_timestep) {
+        const unsigned int steps = pFramerate->Get_Fixed_Steps();
+
+        for (unsigned int i = 0; i < steps && !game_exit; i++) {
+            pFramerate->Begin_Fixed_Step();
+            Save_Step_Positions();
+            Update_Game_Mode();
+        }
+
+        pFramerate->End_Fixed_Steps();
     }
-    else if (Game_Mode == MODE_LEVEL_SETTINGS) {
-        pLevel_Editor->m_settings_screen->Update();
+    else {
+        Update_Game_Mode();
     }
 
     // gui
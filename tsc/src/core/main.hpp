@@ -39,6 +39,12 @@ namespace TSC {
     */
     void Update_Game(void);
 
+    /* Move the active camera to the interpolated position of the fixed timestep
+     * The previous position is returned in x and y.
+     * Returns the moved camera or NULL if it was not moved.
+    */
+    cCamera* Set_Step_Camera_Pos(float& x, float& y);
+
     /* Draw current game state
      * Should be called continuously from Game Loop.
     */
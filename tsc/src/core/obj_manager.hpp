@@ -37,13 +37,16 @@ namespace TSC {
         // Delete the object from given array number
         virtual bool Delete(size_t array_num, bool delete_data = 1)
         {
-            // if in vector
-            if (array_num < objects.size()) {
-                objects.erase(objects.begin() + array_num);
+            // not in vector
+            if (array_num >= objects.size()) {
+                return 0;
             }
 
+            T* obj = objects[array_num];
+            objects.erase(objects.begin() + array_num);
+
             if (delete_data) {
-                delete objects[array_num];
+                delete obj;
             }
 
             return 1;
@@ -98,7 +101,7 @@ namespace TSC {
         }
 
         // Switch objects array position
-        bool Switch_Array_Num(T* obj1, T* obj2)
+        virtual bool Switch_Array_Num(T* obj1, T* obj2)
         {
             // empty object
             if (!obj1 || !obj2) {
@@ -124,9 +127,7 @@ namespace TSC {
                 return 0;
             }
 
-            // todo: does that work ?
-            itr1 = obj2;
-            itr2 = obj1;
+            std::iter_swap(itr1, itr2);
 
             return 1;
         }
@@ -134,7 +135,7 @@ namespace TSC {
         /* Return the object array number
          * if not found returns -1
         */
-        int Get_Array_Num(T* obj) const
+        virtual int Get_Array_Num(T* obj) const
         {
             // invalid
             if (!obj) {
@@ -0,0 +1,270 @@
+/***************************************************************************
+ * sprite_grid.cpp  -  uniform grid spatial index for sprites
+ *
+ * Copyright © 2013 - 2014 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../core/sprite_grid.hpp"
+#include "../objects/sprite.hpp"
+
+using namespace std;
+
+namespace TSC {
+
+/* *** *** *** *** *** *** cSprite_Grid *** *** *** *** *** *** *** *** *** *** *** */
+
+// cell coordinates are clamped to this to avoid overflows with broken positions
+static const int grid_cell_limit = 1 << 24;
+
+cSprite_Grid::cSprite_Grid(float cell_size /* = 256.0f */)
+    : m_cell_size(cell_size)
+{
+    m_query_stamp = 0;
+}
+
+cSprite_Grid::~cSprite_Grid(void)
+{
+    Clear();
+}
+
+void cSprite_Grid::Add(cSprite* sprite)
+{
+    if (!sprite) {
+        return;
+    }
+
+    cSprite_Grid_Entry& entry = sprite->m_grid_entry;
+
+    // already indexed
+    if (entry.m_grid == this) {
+        Update(sprite);
+        return;
+    }
+    // indexed in another grid
+    else if (entry.m_grid) {
+        entry.m_grid->Remove(sprite);
+    }
+
+    entry.m_grid = this;
+    Get_Cell_Range(sprite->m_col_rect, entry.m_x1, entry.m_y1, entry.m_x2, entry.m_y2);
+    Link(sprite);
+}
+
+void cSprite_Grid::Remove(cSprite* sprite)
+{
+    if (!sprite || sprite->m_grid_entry.m_grid != this) {
+        return;
+    }
+
+    Unlink(sprite);
+    sprite->m_grid_entry = cSprite_Grid_Entry();
+}
+
+void cSprite_Grid::Update(cSprite* sprite)
+{
+    cSprite_Grid_Entry& entry = sprite->m_grid_entry;
+
+    if (entry.m_grid != this) {
+        return;
+    }
+
+    int x1, y1, x2, y2;
+    Get_Cell_Range(sprite->m_col_rect, x1, y1, x2, y2);
+
+    // still in the same cells
+    if (x1 == entry.m_x1 && y1 == entry.m_y1 && x2 == entry.m_x2 && y2 == entry.m_y2) {
+        return;
+    }
+
+    Unlink(sprite);
+    entry.m_x1 = x1;
+    entry.m_y1 = y1;
+    entry.m_x2 = x2;
+    entry.m_y2 = y2;
+    Link(sprite);
+}
+
+void cSprite_Grid::Clear(void)
+{
+    for (Cell_Map::iterator itr = m_cells.begin(); itr != m_cells.end(); ++itr) {
+        vector<cSprite*>& cell = itr->second;
+
+        for (vector<cSprite*>::iterator sitr = cell.begin(); sitr != cell.end(); ++sitr) {
+            (*sitr)->m_grid_entry = cSprite_Grid_Entry();
+        }
+    }
+
+    for (vector<cSprite*>::iterator itr = m_large.begin(); itr != m_large.end(); ++itr) {
+        (*itr)->m_grid_entry = cSprite_Grid_Entry();
+    }
+
+    m_cells.clear();
+    m_large.clear();
+    m_query_stamp = 0;
+}
+
+void cSprite_Grid::Get_Candidates(vector<cSprite*>& candidates, const GL_rect& rect) const
+{
+    m_query_stamp++;
+
+    // stamp wrapped around : reset all stamps
+    if (!m_query_stamp) {
+        for (Cell_Map::const_iterator itr = m_cells.begin(); itr != m_cells.end(); ++itr) {
+            const vector<cSprite*>& cell = itr->second;
+
+            for (vector<cSprite*>::const_iterator sitr = cell.begin(); sitr != cell.end(); ++sitr) {
+                (*sitr)->m_grid_entry.m_query_stamp = 0;
+            }
+        }
+
+        m_query_stamp = 1;
+    }
+
+    int x1, y1, x2, y2;
+    Get_Cell_Range(rect, x1, y1, x2, y2);
+
+    const double cell_count = (static_cast<double>(x2) - x1 + 1) * (static_cast<double>(y2) - y1 + 1);
+
+    // checking every used cell is cheaper than the rect cells
+    if (cell_count > static_cast<double>(m_cells.size())) {
+        for (Cell_Map::const_iterator itr = m_cells.begin(); itr != m_cells.end(); ++itr) {
+            const Cell_Key& key = itr->first;
+
+            if (key.first < x1 || key.first > x2 || key.second < y1 || key.second > y2) {
+                continue;
+            }
+
+            const vector<cSprite*>& cell = itr->second;
+
+            for (vector<cSprite*>::const_iterator sitr = cell.begin(); sitr != cell.end(); ++sitr) {
+                cSprite* obj = (*sitr);
+
+                if (obj->m_grid_entry.m_query_stamp != m_query_stamp) {
+                    obj->m_grid_entry.m_query_stamp = m_query_stamp;
+                    candidates.push_back(obj);
+                }
+            }
+        }
+    }
+    else {
+        for (int y = y1; y <= y2; y++) {
+            for (int x = x1; x <= x2; x++) {
+                Cell_Map::const_iterator itr = m_cells.find(Cell_Key(x, y));
+
+                if (itr == m_cells.end()) {
+                    continue;
+                }
+
+                const vector<cSprite*>& cell = itr->second;
+
+                for (vector<cSprite*>::const_iterator sitr = cell.begin(); sitr != cell.end(); ++sitr) {
+                    cSprite* obj = (*sitr);
+
+                    if (obj->m_grid_entry.m_query_stamp != m_query_stamp) {
+                        obj->m_grid_entry.m_query_stamp = m_query_stamp;
+                        candidates.push_back(obj);
+                    }
+                }
+            }
+        }
+    }
+
+    // large sprites are always candidates
+    candidates.insert(candidates.end(), m_large.begin(), m_large.end());
+}
+
+int cSprite_Grid::Get_Cell(float pos) const
+{
+    const float cell = floor(pos / m_cell_size);
+
+    // also catches NaN
+    if (!(cell > -grid_cell_limit)) {
+        return -grid_cell_limit;
+    }
+    if (cell > grid_cell_limit) {
+        return grid_cell_limit;
+    }
+
+    return static_cast<int>(cell);
+}
+
+void cSprite_Grid::Get_Cell_Range(const GL_rect& rect, int& x1, int& y1, int& x2, int& y2) const
+{
+    // rects are allowed to have a negative size
+    x1 = Get_Cell(std::min(rect.m_x, rect.m_x + rect.m_w));
+    x2 = Get_Cell(std::max(rect.m_x, rect.m_x + rect.m_w));
+    y1 = Get_Cell(std::min(rect.m_y, rect.m_y + rect.m_h));
+    y2 = Get_Cell(std::max(rect.m_y, rect.m_y + rect.m_h));
+}
+
+void cSprite_Grid::Link(cSprite* sprite)
+{
+    cSprite_Grid_Entry& entry = sprite->m_grid_entry;
+    const double cell_count = (static_cast<double>(entry.m_x2) - entry.m_x1 + 1) * (static_cast<double>(entry.m_y2) - entry.m_y1 + 1);
+
+    if (cell_count > m_max_sprite_cells) {
+        entry.m_large = 1;
+        m_large.push_back(sprite);
+        return;
+    }
+
+    entry.m_large = 0;
+
+    for (int y = entry.m_y1; y <= entry.m_y2; y++) {
+        for (int x = entry.m_x1; x <= entry.m_x2; x++) {
+            m_cells[Cell_Key(x, y)].push_back(sprite);
+        }
+    }
+}
+
+void cSprite_Grid::Unlink(cSprite* sprite)
+{
+    cSprite_Grid_Entry& entry = sprite->m_grid_entry;
+
+    if (entry.m_large) {
+        vector<cSprite*>::iterator itr = std::find(m_large.begin(), m_large.end(), sprite);
+
+        if (itr != m_large.end()) {
+            *itr = m_large.back();
+            m_large.pop_back();
+        }
+
+        return;
+    }
+
+    for (int y = entry.m_y1; y <= entry.m_y2; y++) {
+        for (int x = entry.m_x1; x <= entry.m_x2; x++) {
+            Cell_Map::iterator itr = m_cells.find(Cell_Key(x, y));
+
+            if (itr == m_cells.end()) {
+                continue;
+            }
+
+            vector<cSprite*>& cell = itr->second;
+            vector<cSprite*>::iterator sitr = std::find(cell.begin(), cell.end(), sprite);
+
+            if (sitr != cell.end()) {
+                *sitr = cell.back();
+                cell.pop_back();
+            }
+
+            // free empty cells
+            if (cell.empty()) {
+                m_cells.erase(itr);
+            }
+        }
+    }
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
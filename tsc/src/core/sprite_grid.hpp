@@ -0,0 +1,104 @@
+/***************************************************************************
+ * sprite_grid.h  -  uniform grid spatial index for sprites
+ *
+ * Copyright © 2013 - 2014 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_SPRITE_GRID_HPP
+#define TSC_SPRITE_GRID_HPP
+
+#include "../core/global_basic.hpp"
+#include "../core/global_game.hpp"
+#include "../core/math/rect.hpp"
+
+namespace TSC {
+
+    /* *** *** *** *** *** cSprite_Grid_Entry *** *** *** *** *** *** *** *** *** *** *** *** */
+
+    /* Grid bookkeeping stored in every sprite
+     * only the grid itself should modify this
+    */
+    struct cSprite_Grid_Entry {
+        cSprite_Grid_Entry(void)
+            : m_grid(NULL), m_x1(0), m_y1(0), m_x2(-1), m_y2(-1), m_large(0), m_query_stamp(0) {};
+
+        // grid the sprite is indexed in or NULL
+        cSprite_Grid* m_grid;
+        // registered cell range
+        int m_x1;
+        int m_y1;
+        int m_x2;
+        int m_y2;
+        // if the sprite covers too many cells and is stored in the large list
+        bool m_large;
+        // last query which returned this sprite
+        unsigned int m_query_stamp;
+    };
+
+    /* *** *** *** *** *** cSprite_Grid *** *** *** *** *** *** *** *** *** *** *** *** */
+
+    /* Uniform grid over the sprite collision rects
+     * Used as broad phase by the sprite manager collision queries.
+     * Cells are hashed so the grid has no fixed bounds.
+    */
+    class cSprite_Grid {
+    public:
+        cSprite_Grid(float cell_size = 256.0f);
+        ~cSprite_Grid(void);
+
+        // Add the sprite using its current collision rect
+        void Add(cSprite* sprite);
+        // Remove the sprite if it is indexed in this grid
+        void Remove(cSprite* sprite);
+        // Update the sprite cells from its current collision rect
+        void Update(cSprite* sprite);
+        // Remove all sprites
+        void Clear(void);
+
+        /* Add all sprites from the cells touching the given rect
+         * every sprite is only added once but it may not intersect the rect
+        */
+        void Get_Candidates(std::vector<cSprite*>& candidates, const GL_rect& rect) const;
+
+        // Return the number of used cells
+        size_t Get_Cell_Count(void) const
+        {
+            return m_cells.size();
+        }
+
+        // cell width and height
+        const float m_cell_size;
+        // sprites covering more cells are stored in the large list
+        static const int m_max_sprite_cells = 64;
+
+    private:
+        typedef std::pair<int, int> Cell_Key;
+        typedef boost::unordered_map<Cell_Key, std::vector<cSprite*> > Cell_Map;
+
+        // Return the cell coordinate for the given position
+        int Get_Cell(float pos) const;
+        // Set the cell range from the sprite collision rect
+        void Get_Cell_Range(const GL_rect& rect, int& x1, int& y1, int& x2, int& y2) const;
+        // Insert or remove the sprite from its registered cells
+        void Link(cSprite* sprite);
+        void Unlink(cSprite* sprite);
+
+        Cell_Map m_cells;
+        std::vector<cSprite*> m_large;
+        mutable unsigned int m_query_stamp;
+    };
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
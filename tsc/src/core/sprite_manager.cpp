@@ -20,7 +20,9 @@
 #include "../input/mouse.hpp"
 #include "../overworld/world_player.hpp"
 #include "../enemies/enemy.hpp"
+#include "../core/benchmark.hpp"
 #include "../core/global_basic.hpp"
+#include <typeinfo>
 
 using namespace std;
 
@@ -28,12 +30,18 @@ namespace TSC {
 
 /* *** *** *** *** *** *** cSprite_Manager *** *** *** *** *** *** *** *** *** *** *** */
 
+const cSprite_List cSprite_Manager::m_empty_list;
+
 cSprite_Manager::cSprite_Manager(unsigned int reserve_items /* = 2000 */, unsigned int zpos_items /* = 100 */)
     : cObject_Manager<cSprite>()
 {
     objects.reserve(reserve_items);
 
-    m_max_uid_mark = 1; // UID 0 is reserved for the player
+    Reset_UIDs();
+    m_use_broad_phase = 1;
+    m_use_swept_collision = 0;
+    m_active_region = 0.0f;
+    m_update_stamp = 0;
     m_z_pos_data.assign(zpos_items, 0.0f);
     m_z_pos_data_editor.assign(zpos_items,0.0f);
 }
@@ -75,9 +83,14 @@ void cSprite_Manager::Add(cSprite* sprite)
 //#endif
 
         // Mark the sprite’s UID as taken
-        m_uid_pool.erase(sprite->m_uid);
+        m_uid_used[sprite->m_uid] = 1;
     }
 
+    Add_UID_Index(sprite);
+
+    // not known to the broad phase candidates
+    m_broad_phase.Invalidate();
+
     // Check if an destroyed object can be replaced
     for (cSprite_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
         // get object pointer
@@ -87,18 +100,281 @@ void cSprite_Manager::Add(cSprite* sprite)
         if (obj->m_auto_destroy) {
             // set new object
             *itr = sprite;
+            sprite->m_array_num = obj->m_array_num;
+            obj->m_array_num = -1;
 
             // Release old sprite’s UID by putting it back into the UID pool
-            m_uid_pool.insert(obj->m_uid);
+            Remove_UID_Index(obj);
+            Release_UID(obj->m_uid);
 
             // delete old
+            Remove_From_Indices(obj);
             delete obj;
 
+            Add_To_Indices(sprite);
             return;
         }
     }
 
     cObject_Manager<cSprite>::Add(sprite);
+    sprite->m_array_num = objects.size() - 1;
+    Add_To_Indices(sprite);
+}
+
+bool cSprite_Manager::Delete(size_t array_num, bool delete_data /* = 1 */)
+{
+    if (array_num >= objects.size()) {
+        return 0;
+    }
+
+    return Delete(objects[array_num], delete_data);
+}
+
+bool cSprite_Manager::Delete(cSprite* obj, bool delete_data /* = 1 */)
+{
+    // empty object
+    if (!obj) {
+        return 0;
+    }
+
+    const int array_num = Get_Array_Num(obj);
+
+    // not available
+    if (array_num < 0) {
+        return 0;
+    }
+
+    Remove_From_Indices(obj);
+    Remove_UID_Index(obj);
+
+    // keep the order as it is the save and z order
+    objects.erase(objects.begin() + array_num);
+    obj->m_array_num = -1;
+    Update_Array_Nums(array_num, objects.size());
+
+    if (delete_data) {
+        delete obj;
+    }
+
+    return 1;
+}
+
+bool cSprite_Manager::Switch_Array_Num(cSprite* obj1, cSprite* obj2)
+{
+    const int num1 = Get_Array_Num(obj1);
+    const int num2 = Get_Array_Num(obj2);
+
+    // not available
+    if (num1 < 0 || num2 < 0) {
+        return 0;
+    }
+
+    objects[num1] = obj2;
+    objects[num2] = obj1;
+    obj1->m_array_num = num2;
+    obj2->m_array_num = num1;
+
+    return 1;
+}
+
+int cSprite_Manager::Get_Array_Num(cSprite* obj) const
+{
+    // invalid
+    if (!obj || obj->m_array_num < 0) {
+        return -1;
+    }
+
+    // not in this manager
+    if (static_cast<size_t>(obj->m_array_num) >= objects.size() || objects[obj->m_array_num] != obj) {
+        return -1;
+    }
+
+    return obj->m_array_num;
+}
+
+bool cSprite_Manager::Can_Be_Static(const cSprite* sprite) const
+{
+    // subclasses move or update on their own
+    if (typeid(*sprite) != typeid(cSprite)) {
+        return 0;
+    }
+
+    // spawned or controlled from elsewhere
+    if (sprite->m_spawned || sprite->m_disallow_sleep || sprite->m_sprite_manager != this) {
+        return 0;
+    }
+
+    // animated
+    if (sprite->m_anim_enabled && sprite->m_anim_img_end != 0) {
+        return 0;
+    }
+
+    return 1;
+}
+
+void cSprite_Manager::Add_To_Indices(cSprite* sprite)
+{
+    Add_Type_Index(sprite);
+
+    if (Can_Be_Static(sprite)) {
+        sprite->m_static = 1;
+        m_static_grid.Add(sprite);
+        m_static_layer.Add(sprite);
+        return;
+    }
+
+    sprite->m_static = 0;
+    // new sprites are awake until the next update
+    sprite->m_awake_stamp = m_update_stamp;
+    m_grid.Add(sprite);
+    m_dynamic_objects.push_back(sprite);
+
+    // without a region nothing sleeps
+    if (m_active_region > 0.0f && !Can_Sleep(sprite)) {
+        m_awake_objects.push_back(sprite);
+    }
+}
+
+void cSprite_Manager::Remove_From_Indices(cSprite* sprite)
+{
+    Remove_Type_Index(sprite);
+    m_grid.Remove(sprite);
+    m_static_grid.Remove(sprite);
+    m_static_layer.Remove(sprite);
+
+    if (sprite->m_static) {
+        sprite->m_static = 0;
+    }
+    else {
+        Remove_From_List(m_dynamic_objects, sprite);
+    }
+
+    // may have been queued while it was static
+    Remove_From_List(m_received_collisions, sprite);
+    Remove_From_List(m_awake_objects, sprite);
+}
+
+void cSprite_Manager::Add_Array_Nums(std::vector<size_t>& nums, const cSprite_List& sprites) const
+{
+    for (cSprite_List::const_iterator itr = sprites.begin(); itr != sprites.end(); ++itr) {
+        const int array_num = Get_Array_Num(*itr);
+
+        if (array_num >= 0) {
+            nums.push_back(array_num);
+        }
+    }
+}
+
+void cSprite_Manager::Add_Awake_Array_Nums(std::vector<size_t>& nums, const cSprite_List& sprites) const
+{
+    // without a region nothing sleeps
+    if (m_active_region <= 0.0f) {
+        Add_Array_Nums(nums, sprites);
+        return;
+    }
+
+    for (cSprite_List::const_iterator itr = sprites.begin(); itr != sprites.end(); ++itr) {
+        // sleeping
+        if ((*itr)->m_awake_stamp != m_update_stamp) {
+            continue;
+        }
+
+        const int array_num = Get_Array_Num(*itr);
+
+        if (array_num >= 0) {
+            nums.push_back(array_num);
+        }
+    }
+}
+
+bool cSprite_Manager::Can_Sleep(const cSprite* sprite) const
+{
+    if (sprite->m_disallow_sleep || sprite->m_spawned) {
+        return 0;
+    }
+
+    // would still be updated outside of the region
+    if (sprite->m_camera_range > m_active_region) {
+        return 0;
+    }
+
+    return 1;
+}
+
+void cSprite_Manager::Remove_From_List(cSprite_List& sprites, cSprite* sprite)
+{
+    cSprite_List::iterator itr = std::find(sprites.begin(), sprites.end(), sprite);
+
+    if (itr != sprites.end()) {
+        *itr = sprites.back();
+        sprites.pop_back();
+    }
+}
+
+void cSprite_Manager::Add_Type_Index(cSprite* sprite)
+{
+    const unsigned int type = sprite->m_type;
+    const unsigned int sprite_array = sprite->m_sprite_array;
+
+    if (type >= m_type_objects.size()) {
+        m_type_objects.resize(type + 1);
+    }
+    if (sprite_array >= m_array_objects.size()) {
+        m_array_objects.resize(sprite_array + 1);
+    }
+
+    sprite->m_indexed_type = sprite->m_type;
+    sprite->m_type_list_num = m_type_objects[type].size();
+    m_type_objects[type].push_back(sprite);
+
+    sprite->m_indexed_array = sprite->m_sprite_array;
+    sprite->m_array_list_num = m_array_objects[sprite_array].size();
+    m_array_objects[sprite_array].push_back(sprite);
+}
+
+void cSprite_Manager::Remove_Type_Index(cSprite* sprite)
+{
+    // move the last one into the free position
+    if (sprite->m_type_list_num >= 0) {
+        cSprite_List& sprites = m_type_objects[sprite->m_indexed_type];
+
+        sprites.back()->m_type_list_num = sprite->m_type_list_num;
+        sprites[sprite->m_type_list_num] = sprites.back();
+        sprites.pop_back();
+        sprite->m_type_list_num = -1;
+    }
+
+    if (sprite->m_array_list_num >= 0) {
+        cSprite_List& sprites = m_array_objects[sprite->m_indexed_array];
+
+        sprites.back()->m_array_list_num = sprite->m_array_list_num;
+        sprites[sprite->m_array_list_num] = sprites.back();
+        sprites.pop_back();
+        sprite->m_array_list_num = -1;
+    }
+}
+
+void cSprite_Manager::Update_Type_Index(cSprite* sprite)
+{
+    // not added
+    if (Get_Array_Num(sprite) < 0) {
+        return;
+    }
+
+    // not changed
+    if (sprite->m_indexed_type == sprite->m_type && sprite->m_indexed_array == sprite->m_sprite_array) {
+        return;
+    }
+
+    Remove_Type_Index(sprite);
+    Add_Type_Index(sprite);
+}
+
+void cSprite_Manager::Update_Array_Nums(size_t start, size_t end)
+{
+    for (size_t i = start; i < end; i++) {
+        objects[i]->m_array_num = i;
+    }
 }
 
 cSprite* cSprite_Manager::Copy(unsigned int identifier)
@@ -158,25 +434,22 @@ void cSprite_Manager::Move_To_Front(cSprite* sprite)
         return;
     }
 
-    cSprite* first = objects.front();
+    const int array_num = Get_Array_Num(sprite);
 
-    // if already in front
-    if (sprite == first) {
+    // not available
+    if (array_num < 0) {
+        // fixme : should not happen but it does
         return;
     }
 
-    // get iterator
-    cSprite_List::iterator itr = std::find(objects.begin(), objects.end(), sprite);
-
-    // not available
-    if (itr == objects.end()) {
-        // fixme : should not happen but it does
+    // if already in front
+    if (array_num == 0) {
         return;
     }
 
-    objects.erase(itr);
-    objects.front() = sprite;
-    objects.insert(objects.begin() + 1, first);
+    // shift the objects before it one back
+    std::rotate(objects.begin(), objects.begin() + array_num, objects.begin() + array_num + 1);
+    Update_Array_Nums(0, array_num + 1);
 
     // make it the first z position
     sprite->m_pos_z = Get_First(sprite->m_type)->m_pos_z - cSprite::m_pos_z_delta;
@@ -189,25 +462,22 @@ void cSprite_Manager::Move_To_Back(cSprite* sprite)
         return;
     }
 
-    cSprite* last = objects.back();
+    const int array_num = Get_Array_Num(sprite);
 
-    // if already in back
-    if (sprite == last) {
+    // not available
+    if (array_num < 0) {
+        // fixme : should not happen but it does
         return;
     }
 
-    // get iterator
-    cSprite_List::iterator itr = std::find(objects.begin(), objects.end(), sprite);
-
-    // not available
-    if (itr == objects.end()) {
-        // fixme : should not happen but it does
+    // if already in back
+    if (static_cast<size_t>(array_num) == objects.size() - 1) {
         return;
     }
 
-    objects.erase(itr);
-    objects.back() = sprite;
-    objects.insert(objects.end() - 1, last);
+    // shift the objects after it one forward
+    std::rotate(objects.begin() + array_num, objects.begin() + array_num + 1, objects.end());
+    Update_Array_Nums(array_num, objects.size());
 
     // make it the last z position
     Ensure_Different_Z(sprite);
@@ -226,36 +496,178 @@ void cSprite_Manager::Delete_All(bool delayed /* = 0 */)
     }
     // instant
     else {
-        // remove objects that can not be auto-deleted
-        for (cSprite_List::iterator itr = objects.begin(); itr != objects.end();) {
+        // no need to remove every sprite on its own
+        m_grid.Clear();
+        m_static_grid.Clear();
+        m_static_layer.Clear();
+        m_awake_objects.clear();
+        m_dynamic_objects.clear();
+        m_received_collisions.clear();
+        m_type_objects.clear();
+        m_array_objects.clear();
+
+        for (cSprite_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
             // get object pointer
             cSprite* obj = (*itr);
 
+            // objects that can not be auto-deleted are only removed
             if (obj->m_disallow_managed_delete) {
-                itr = objects.erase(itr);
+                obj->m_array_num = -1;
+                obj->m_static = 0;
+                obj->m_type_list_num = -1;
+                obj->m_array_list_num = -1;
             }
-            // increment
             else {
-                ++itr;
+                delete obj;
             }
         }
 
-        cObject_Manager<cSprite>::Delete_All();
+        objects.clear();
     }
 
     // Empty the UID pool, we have no sprites anymore
-    m_uid_pool.clear();
+    Reset_UIDs();
 
     // clear z position data
     std::fill(m_z_pos_data.begin(), m_z_pos_data.end(), 0.0f);
     std::fill(m_z_pos_data_editor.begin(), m_z_pos_data_editor.end(), 0.0f);
 }
 
+void cSprite_Manager::Update_Items(void)
+{
+    m_update_nums.clear();
+    m_update_stamp++;
+
+    // update all dynamic sprites
+    if (m_active_region <= 0.0f) {
+        Add_Array_Nums(m_update_nums, m_dynamic_objects);
+    }
+    // only the ones near the camera
+    else {
+        const GL_rect region(pActive_Camera->m_x - m_active_region, pActive_Camera->m_y - m_active_region, game_res_w + (m_active_region * 2.0f), game_res_h + (m_active_region * 2.0f));
+
+        m_update_candidates.clear();
+        m_grid.Get_Candidates(m_update_candidates, region);
+        Add_Array_Nums(m_update_nums, m_update_candidates);
+        Add_Array_Nums(m_update_nums, m_awake_objects);
+    }
+
+    // update in array order as without the active region
+    std::sort(m_update_nums.begin(), m_update_nums.end());
+    m_update_nums.erase(std::unique(m_update_nums.begin(), m_update_nums.end()), m_update_nums.end());
+
+    const size_t count = objects.size();
+
+    /* the array number is used as destroyed sprites can get
+     * replaced by sprites added while updating
+    */
+    for (std::vector<size_t>::const_iterator itr = m_update_nums.begin(); itr != m_update_nums.end(); ++itr) {
+        if (*itr < objects.size()) {
+            objects[*itr]->m_awake_stamp = m_update_stamp;
+            objects[*itr]->Update();
+        }
+    }
+
+    // sprites added while updating
+    for (size_t i = count; i < objects.size(); i++) {
+        objects[i]->m_awake_stamp = m_update_stamp;
+        objects[i]->Update();
+    }
+}
+
+void cSprite_Manager::Update_Items_Late(void)
+{
+    m_update_nums.clear();
+    Add_Awake_Array_Nums(m_update_nums, m_dynamic_objects);
+    std::sort(m_update_nums.begin(), m_update_nums.end());
+
+    const size_t count = objects.size();
+
+    for (std::vector<size_t>::const_iterator itr = m_update_nums.begin(); itr != m_update_nums.end(); ++itr) {
+        if (*itr < objects.size()) {
+            objects[*itr]->Update_Late();
+        }
+    }
+
+    // sprites added while updating
+    for (size_t i = count; i < objects.size(); i++) {
+        objects[i]->Update_Late();
+    }
+}
+
+void cSprite_Manager::Draw_Items(void)
+{
+    const bool static_layer = m_static_layer.Draw(objects);
+
+    for (cSprite_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+        cSprite* obj = (*itr);
+
+        // already drawn with its chunk
+        if (static_layer && obj->m_static_layer_entry.m_layer) {
+            continue;
+        }
+
+        obj->Draw();
+    }
+}
+
+void cSprite_Manager::Save_Items_Step_Pos(void)
+{
+    // static sprites never move
+    for (cSprite_List::iterator itr = m_dynamic_objects.begin(); itr != m_dynamic_objects.end(); ++itr) {
+        (*itr)->Save_Step_Pos();
+    }
+}
+
+void cSprite_Manager::Set_Dynamic(cSprite* sprite)
+{
+    if (!sprite->m_static) {
+        return;
+    }
+
+    sprite->m_static = 0;
+    // moved in this frame
+    sprite->m_awake_stamp = m_update_stamp;
+    // also removes it from the static grid
+    m_grid.Add(sprite);
+    m_static_layer.Remove(sprite);
+    m_dynamic_objects.push_back(sprite);
+
+    if (m_active_region > 0.0f && !Can_Sleep(sprite)) {
+        m_awake_objects.push_back(sprite);
+    }
+
+    // may have left the broad phase candidates
+    m_broad_phase.Invalidate();
+}
+
+void cSprite_Manager::Add_Received_Collision(cSprite* sprite)
+{
+    if (!sprite->m_static) {
+        // awake sprites handle their collisions themselves
+        if (m_active_region <= 0.0f || sprite->m_awake_stamp == m_update_stamp) {
+            return;
+        }
+        // not in this manager
+        if (Get_Array_Num(sprite) < 0) {
+            return;
+        }
+
+        // wake it up
+        sprite->m_awake_stamp = m_update_stamp;
+    }
+
+    if (std::find(m_received_collisions.begin(), m_received_collisions.end(), sprite) == m_received_collisions.end()) {
+        m_received_collisions.push_back(sprite);
+    }
+}
+
 cSprite* cSprite_Manager::Get_First(const SpriteType type) const
 {
     cSprite* first = NULL;
+    const cSprite_List& type_objects = Get_Objects_by_Type(type);
 
-    for (cSprite_List::const_iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+    for (cSprite_List::const_iterator itr = type_objects.begin(); itr != type_objects.end(); ++itr) {
         // get object pointer
         cSprite* obj = (*itr);
 
@@ -271,8 +683,9 @@ cSprite* cSprite_Manager::Get_First(const SpriteType type) const
 cSprite* cSprite_Manager::Get_Last(const SpriteType type) const
 {
     cSprite* last = NULL;
+    const cSprite_List& type_objects = Get_Objects_by_Type(type);
 
-    for (cSprite_List::const_iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+    for (cSprite_List::const_iterator itr = type_objects.begin(); itr != type_objects.end(); ++itr) {
         // get object pointer
         cSprite* obj = (*itr);
 
@@ -287,7 +700,11 @@ cSprite* cSprite_Manager::Get_Last(const SpriteType type) const
 
 cSprite* cSprite_Manager::Get_from_Position(int start_pos_x, int start_pos_y, const SpriteType type /* = TYPE_UNDEFINED */, bool check_pos /* = false */) const
 {
-    for (cSprite_List::const_iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+    // if type is given only check these objects
+    const cSprite_List& check_objects = (type != TYPE_UNDEFINED) ? Get_Objects_by_Type(type) : objects;
+    cSprite* found = NULL;
+
+    for (cSprite_List::const_iterator itr = check_objects.begin(); itr != check_objects.end(); ++itr) {
         // get object pointer
         cSprite* obj = (*itr);
 
@@ -299,28 +716,48 @@ cSprite* cSprite_Manager::Get_from_Position(int start_pos_x, int start_pos_y, co
             continue;
         }
 
-        // if type is given
-        if (type != TYPE_UNDEFINED) {
-            // skip invalid type
-            if (obj->m_type != type) {
-                continue;
-            }
+        // the type list is not in array order : return the first in the array
+        if (!found || obj->m_array_num < found->m_array_num) {
+            found = obj;
         }
 
-        // found
-        return obj;
+        // the array is in order
+        if (type == TYPE_UNDEFINED) {
+            break;
+        }
     }
 
-    return NULL;
+    return found;
 }
 
-cSprite* cSprite_Manager::Get_by_UID(int uid) const
+const cSprite_List& cSprite_Manager::Get_Objects_by_Type(const SpriteType type) const
 {
-    for (cSprite_List::const_iterator itr = objects.begin(); itr != objects.end(); ++itr) {
-        if ((*itr)->m_uid == uid)
-            return *itr;
+    if (static_cast<unsigned int>(type) >= m_type_objects.size()) {
+        return m_empty_list;
     }
-    return NULL;
+
+    return m_type_objects[type];
+}
+
+const cSprite_List& cSprite_Manager::Get_Objects_by_Array(const ArrayType sprite_array) const
+{
+    if (static_cast<unsigned int>(sprite_array) >= m_array_objects.size()) {
+        return m_empty_list;
+    }
+
+    return m_array_objects[sprite_array];
+}
+
+cSprite* cSprite_Manager::Get_by_UID(int uid) const
+{
+    if (uid < 0 || uid >= m_max_uid_mark)
+        return NULL;
+
+    // the lookup itself is too short to be timed
+    if (game_debug_performance)
+        m_uid_lookup_count++;
+
+    return m_uid_sprites[uid];
 }
 
 void cSprite_Manager::Get_Objects_sorted(cSprite_List& new_objects, bool editor_sort /* = 0 */, bool with_player /* = 0 */) const
@@ -343,6 +780,103 @@ void cSprite_Manager::Get_Objects_sorted(cSprite_List& new_objects, bool editor_
 }
 
 void cSprite_Manager::Get_Colliding_Objects(cSprite_List& col_objects, const GL_rect& rect, bool with_player /* = 0 */, const cSprite* exclude_sprite /* = NULL */) const
+{
+    TSC_BENCHMARK_SCOPE(pBenchmark_Colliding_Objects);
+
+    const size_t start = col_objects.size();
+
+    // get nearby objects from the broad phase or the grid
+    cSprite_List grid_objects;
+    const cSprite_List* candidates = m_broad_phase.Get_Candidates(exclude_sprite, rect);
+
+    if (!candidates) {
+        m_grid.Get_Candidates(grid_objects, rect);
+        m_static_grid.Get_Candidates(grid_objects, rect);
+        candidates = &grid_objects;
+    }
+
+    // Check objects
+    for (cSprite_List::const_iterator itr = candidates->begin(); itr != candidates->end(); ++itr) {
+        // get object pointer
+        cSprite* obj = (*itr);
+
+        // if destroyed object or the player from the broad phase
+        if (obj == exclude_sprite || obj->m_auto_destroy || obj == pActive_Player) {
+            continue;
+        }
+
+        // if rects don't touch
+        if (!rect.Intersects(obj->m_col_rect)) {
+            continue;
+        }
+
+        col_objects.push_back(obj);
+    }
+
+    // the candidates are not in the array order of the full scan
+    std::sort(col_objects.begin() + start, col_objects.end(), array_num_sort());
+
+    if (with_player && pActive_Player != exclude_sprite) {
+        if (rect.Intersects(pActive_Player->m_col_rect)) {
+            col_objects.push_back(pActive_Player);
+        }
+    }
+
+#ifdef TSC_SPRITE_GRID_CHECK
+    cSprite_List full_objects;
+    Get_Colliding_Objects_Full(full_objects, rect, with_player, exclude_sprite);
+    Check_Grid_Result(cSprite_List(col_objects.begin() + start, col_objects.end()), full_objects, "rect");
+#endif
+}
+
+void cSprite_Manager::Get_Colliding_Objects(cSprite_List& col_objects, const GL_Circle& circle, bool with_player /* = 0 */, const cSprite* exclude_sprite /* = NULL */) const
+{
+    TSC_BENCHMARK_SCOPE(pBenchmark_Colliding_Objects);
+
+    const size_t start = col_objects.size();
+
+    // get objects near the circle bounding rect
+    const float radius = circle.Get_Radius();
+    const GL_rect circle_rect(circle.Get_X() - radius, circle.Get_Y() - radius, radius * 2.0f, radius * 2.0f);
+    cSprite_List candidates;
+    m_grid.Get_Candidates(candidates, circle_rect);
+    m_static_grid.Get_Candidates(candidates, circle_rect);
+
+    // Check objects
+    for (cSprite_List::const_iterator itr = candidates.begin(); itr != candidates.end(); ++itr) {
+        // get object pointer
+        cSprite* obj = (*itr);
+
+        // if destroyed object
+        if (obj == exclude_sprite || obj->m_auto_destroy) {
+            continue;
+        }
+
+        // if circles don't touch
+        if (!circle.Intersects(obj->m_col_rect)) {
+            continue;
+        }
+
+        col_objects.push_back(obj);
+    }
+
+    // the candidates are not in the array order of the full scan
+    std::sort(col_objects.begin() + start, col_objects.end(), array_num_sort());
+
+    if (with_player && pActive_Player != exclude_sprite) {
+        if (circle.Intersects(pActive_Player->m_col_rect)) {
+            col_objects.push_back(pActive_Player);
+        }
+    }
+
+#ifdef TSC_SPRITE_GRID_CHECK
+    cSprite_List full_objects;
+    Get_Colliding_Objects_Full(full_objects, circle, with_player, exclude_sprite);
+    Check_Grid_Result(cSprite_List(col_objects.begin() + start, col_objects.end()), full_objects, "circle");
+#endif
+}
+
+void cSprite_Manager::Get_Colliding_Objects_Full(cSprite_List& col_objects, const GL_rect& rect, bool with_player /* = 0 */, const cSprite* exclude_sprite /* = NULL */) const
 {
     // Check objects
     for (cSprite_List::const_iterator itr = objects.begin(); itr != objects.end(); ++itr) {
@@ -369,7 +903,7 @@ void cSprite_Manager::Get_Colliding_Objects(cSprite_List& col_objects, const GL_
     }
 }
 
-void cSprite_Manager::Get_Colliding_Objects(cSprite_List& col_objects, const GL_Circle& circle, bool with_player /* = 0 */, const cSprite* exclude_sprite /* = NULL */) const
+void cSprite_Manager::Get_Colliding_Objects_Full(cSprite_List& col_objects, const GL_Circle& circle, bool with_player /* = 0 */, const cSprite* exclude_sprite /* = NULL */) const
 {
     // Check objects
     for (cSprite_List::const_iterator itr = objects.begin(); itr != objects.end(); ++itr) {
@@ -398,65 +932,136 @@ void cSprite_Manager::Get_Colliding_Objects(cSprite_List& col_objects, const GL_
 
 void cSprite_Manager::Handle_Collision_Items(void)
 {
-    for (cSprite_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
-        cSprite* obj = (*itr);
+    // get the collision candidates of all moving sprites at once
+    if (m_use_broad_phase) {
+        m_broad_phase.Build(m_dynamic_objects, pActive_Player, &m_static_grid);
+    }
 
-        // invalid
-        if (obj->m_auto_destroy) {
-            if (obj->m_collisions.size()) {
-                debug_print("Collision with a destroyed object (%s)\n", obj->Create_Name().c_str());
-                obj->Clear_Collisions();
-            }
+    m_update_nums.clear();
+    Add_Awake_Array_Nums(m_update_nums, m_dynamic_objects);
+    std::sort(m_update_nums.begin(), m_update_nums.end());
 
-            continue;
+    // sprites woken up while updating are handled with the awake ones
+    for (cSprite_List::iterator itr = m_received_collisions.begin(); itr != m_received_collisions.end();) {
+        if (!(*itr)->m_static) {
+            *itr = m_received_collisions.back();
+            m_received_collisions.pop_back();
         }
+        else {
+            ++itr;
+        }
+    }
+
+    const size_t count = objects.size();
 
-        // collision and movement handling
-        obj->Collide_Move();
-        // handle found collisions
-        obj->Handle_Collisions();
+    for (std::vector<size_t>::const_iterator itr = m_update_nums.begin(); itr != m_update_nums.end(); ++itr) {
+        if (*itr < objects.size()) {
+            Handle_Collision_Item(objects[*itr]);
+        }
     }
+
+    // sprites added while handling
+    for (size_t i = count; i < objects.size(); i++) {
+        Handle_Collision_Item(objects[i]);
+    }
+
+    // static and woken up sprites only handle received collisions
+    while (!m_received_collisions.empty()) {
+        m_update_nums.clear();
+        Add_Array_Nums(m_update_nums, m_received_collisions);
+        std::sort(m_update_nums.begin(), m_update_nums.end());
+        m_received_collisions.clear();
+
+        for (std::vector<size_t>::const_iterator itr = m_update_nums.begin(); itr != m_update_nums.end(); ++itr) {
+            if (*itr < objects.size()) {
+                Handle_Collision_Item(objects[*itr]);
+            }
+        }
+    }
+
+    m_broad_phase.Clear();
 }
 
-unsigned int cSprite_Manager::Get_Size_Array(const ArrayType sprite_array)
+void cSprite_Manager::Handle_Collision_Item(cSprite* obj)
 {
-    unsigned int count = 0;
-
-    for (cSprite_List::const_iterator itr = objects.begin(); itr != objects.end(); ++itr) {
-        if ((*itr)->m_sprite_array == sprite_array) {
-            count++;
+    // invalid
+    if (obj->m_auto_destroy) {
+        if (obj->m_collisions.size()) {
+            debug_print("Collision with a destroyed object (%s)\n", obj->Create_Name().c_str());
+            obj->Clear_Collisions();
         }
+
+        return;
     }
 
-    return count;
+    // collision and movement handling
+    obj->Collide_Move();
+    // handle found collisions
+    obj->Handle_Collisions();
 }
 
-/* The member m_uid_pool contains a list of all those UIDs that
- * are *not* currently in use, sorted from the smallest to
- * the greatest (not necessarily without gaps, as destroyed
- * sprites give their UID back into the pool). This allows
- * use to quickly find the next free UID without much searching
- * by just picking the very first element from m_uid_pool,
- * which, as said, is always sorted and stays so.
+#ifdef TSC_SPRITE_GRID_CHECK
+void cSprite_Manager::Check_Grid_Result(const cSprite_List& grid_objects, const cSprite_List& full_objects, const char* query) const
+{
+    // the order is also compared as it decides the collision handling order
+    if (grid_objects == full_objects) {
+        return;
+    }
+
+    cSprite_List grid_sorted = grid_objects;
+    cSprite_List full_sorted = full_objects;
+    std::sort(grid_sorted.begin(), grid_sorted.end());
+    std::sort(full_sorted.begin(), full_sorted.end());
+
+    if (grid_sorted == full_sorted) {
+        cerr << "Warning : Sprite grid " << query << " query returned " << grid_objects.size() << " objects in another order than the full scan" << endl;
+        return;
+    }
+
+    cerr << "Warning : Sprite grid " << query << " query returned " << grid_objects.size() << " objects but the full scan " << full_objects.size() << endl;
+
+    for (cSprite_List::const_iterator itr = full_sorted.begin(); itr != full_sorted.end(); ++itr) {
+        if (!std::binary_search(grid_sorted.begin(), grid_sorted.end(), *itr)) {
+            cerr << "  missing " << (*itr)->Create_Name() << " (UID " << (*itr)->m_uid << ")" << endl;
+        }
+    }
+    for (cSprite_List::const_iterator itr = grid_sorted.begin(); itr != grid_sorted.end(); ++itr) {
+        if (!std::binary_search(full_sorted.begin(), full_sorted.end(), *itr)) {
+            cerr << "  unexpected " << (*itr)->Create_Name() << " (UID " << (*itr)->m_uid << ")" << endl;
+        }
+    }
+}
+#endif
+
+/* The member m_uid_used has one flag for every UID below
+ * m_max_uid_mark that tells whether the UID is currently taken
+ * (destroyed sprites clear their flag again, so there may be gaps).
+ * m_uid_free_hint is a counter below which all UIDs are known to
+ * be taken, so the search for the next free UID just starts there
+ * and walks upwards instead of scanning from 1 every time. Releasing
+ * a UID moves the hint back down to it.
  *
- * However, at the level start this would mean that m_uid_pool
- * must contain infinitely many numbers reaching from 1 to ∞. Well,
- * OK, not ∞, because CEGUI’s XML handler can only handle the
- * bare `int' type and is hence limited to INT_MAX. As we don’t want
+ * At the level start we would need flags for all UIDs reaching from
+ * 1 to ∞. Well, OK, not ∞, because CEGUI’s XML handler can only handle
+ * the bare `int' type and is hence limited to INT_MAX. As we don’t want
  * to allocate space for all those possible UIDs which we will likely
  * never need right from the start on, we instead just allocate the
- * next ten UIDs for the pool if it is empty, remembering the new
- * highest possible UID in m_max_uid_mark. */
+ * next ten UIDs if every flag below m_max_uid_mark is set, remembering
+ * the new highest possible UID in m_max_uid_mark. */
 int cSprite_Manager::Generate_UID()
 {
+    // Find the first available UID
+    int uid = m_uid_free_hint;
+    while (uid < m_max_uid_mark && m_uid_used[uid])
+        uid++;
+
     // Allocate 10 new UIDs if the pool is empty
-    if (m_uid_pool.empty())
-        Allocate_UIDs(m_max_uid_mark + 10);
+    if (uid >= m_max_uid_mark)
+        Allocate_UIDs(static_cast<long>(m_max_uid_mark) + 10);
 
-    // Pool is not empty, return the first available UID.
-    std::set<int>::const_iterator iter = m_uid_pool.begin();
-    m_uid_pool.erase(iter);
-    return *iter;
+    m_uid_used[uid] = 1;
+    m_uid_free_hint = uid + 1;
+    return uid;
 }
 
 // We need `long', because we must check an `int' overflow (see below)
@@ -473,8 +1078,8 @@ void cSprite_Manager::Allocate_UIDs(long new_max_uid_mark)
         throw(std::range_error("Too many sprites, unable to generate further UIDs!"));
 
     // Actually allocate the numbers for the UID pool
-    for (int i = m_max_uid_mark; i < static_cast<int>(new_max_uid_mark); i++) // new_max_uid_mark is guaranteed to be < INT_MAX
-        m_uid_pool.insert(i);
+    m_uid_used.resize(new_max_uid_mark, 0); // new_max_uid_mark is guaranteed to be < INT_MAX
+    m_uid_sprites.resize(new_max_uid_mark, NULL);
 
     // Remember the new maximum. Note that by checking INT_MAX, we have
     // ensured the values fits into an int.
@@ -487,15 +1092,67 @@ bool cSprite_Manager::Is_UID_In_Use(int uid)
     if (uid == 0)
         return true;
 
-    // If the UID is in the pool, it is free. If it is greater or equal to
-    // the pool border marker, it is free. Otherwise, it is in use.
+    // If it is greater or equal to the pool border marker, it is free.
+    // Otherwise, the pool knows.
     if (uid >= m_max_uid_mark)
         return false;
 
-    if (m_uid_pool.find(uid) == m_uid_pool.end())
+    if (uid < 0)
         return true;
 
-    return false;
+    return m_uid_used[uid];
+}
+
+void cSprite_Manager::Release_UID(int uid)
+{
+    // The "invalid UID" is never released
+    if (uid <= 0 || uid >= m_max_uid_mark)
+        return;
+
+    m_uid_used[uid] = 0;
+
+    if (uid < m_uid_free_hint)
+        m_uid_free_hint = uid;
+}
+
+void cSprite_Manager::Add_UID_Index(cSprite* sprite)
+{
+    cSprite*& indexed = m_uid_sprites[sprite->m_uid];
+
+    // The first added sprite wins, like with the former array scan
+    if (!indexed)
+        indexed = sprite;
+    else if (indexed != sprite)
+        m_uid_duplicates++;
+}
+
+void cSprite_Manager::Remove_UID_Index(cSprite* sprite)
+{
+    if (sprite->m_uid < 0 || sprite->m_uid >= m_max_uid_mark || m_uid_sprites[sprite->m_uid] != sprite)
+        return;
+
+    m_uid_sprites[sprite->m_uid] = NULL;
+
+    // Only broken levels contain the same UID more than once
+    if (!m_uid_duplicates)
+        return;
+
+    for (cSprite_List::const_iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+        if ((*itr) != sprite && (*itr)->m_uid == sprite->m_uid) {
+            m_uid_sprites[sprite->m_uid] = *itr;
+            return;
+        }
+    }
+}
+
+void cSprite_Manager::Reset_UIDs(void)
+{
+    m_max_uid_mark = 1; // UID 0 is reserved for the player
+    m_uid_free_hint = 1;
+    m_uid_used.assign(1, 1);
+    m_uid_sprites.assign(1, NULL);
+    m_uid_duplicates = 0;
+    m_uid_lookup_count = 0;
 }
 
 /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
@@ -19,6 +19,9 @@
 
 #include "../core/global_game.hpp"
 #include "../core/obj_manager.hpp"
+#include "../core/sprite_grid.hpp"
+#include "../core/broad_phase.hpp"
+#include "../core/static_layer.hpp"
 #include "../objects/movingsprite.hpp"
 
 namespace TSC {
@@ -36,6 +39,18 @@ namespace TSC {
          */
         virtual void Add(cSprite* sprite);
 
+        // Delete the object from given array number
+        virtual bool Delete(size_t array_num, bool delete_data = 1);
+        // Delete the given object
+        virtual bool Delete(cSprite* obj, bool delete_data = 1);
+
+        // Switch objects array position
+        virtual bool Switch_Array_Num(cSprite* obj1, cSprite* obj2);
+        /* Return the object array number
+         * if not found returns -1
+        */
+        virtual int Get_Array_Num(cSprite* obj) const;
+
         // Return a sprite copy
         cSprite* Copy(unsigned int identifier);
 
@@ -64,6 +79,16 @@ namespace TSC {
          * check_pos : if set to true the normal position must be equal to the start position as well
         */
         cSprite* Get_from_Position(int start_pos_x, int start_pos_y, const SpriteType type = TYPE_UNDEFINED, bool check_pos = false) const;
+        /* Return all objects of the given type or array
+         * the lists are kept up to date on adding and deleting
+         * and are not in array order
+        */
+        const cSprite_List& Get_Objects_by_Type(const SpriteType type) const;
+        const cSprite_List& Get_Objects_by_Array(const ArrayType sprite_array) const;
+        /* Update the type and array lists of the sprite
+         * needs to be called if the type or array changes after adding it
+        */
+        void Update_Type_Index(cSprite* sprite);
         /* Return the object assigned the given UID. Returns NULL
          * if no object has this UID.
          */
@@ -77,9 +102,15 @@ namespace TSC {
         /* Get objects colliding with the given rectangle/circle
          * with_player : include player in check
          * exclude_sprite : exclude the given sprite from check
+         * uses the broad phase candidates of exclude_sprite if available
         */
         void Get_Colliding_Objects(cSprite_List& col_objects, const GL_rect& rect, bool with_player = 0, const cSprite* exclude_sprite = NULL) const;
         void Get_Colliding_Objects(cSprite_List& col_objects, const GL_Circle& circle, bool with_player = 0, const cSprite* exclude_sprite = NULL) const;
+        /* Get objects colliding with the given rectangle/circle by checking all objects
+         * this is the reference the grid results are verified against
+        */
+        void Get_Colliding_Objects_Full(cSprite_List& col_objects, const GL_rect& rect, bool with_player = 0, const cSprite* exclude_sprite = NULL) const;
+        void Get_Colliding_Objects_Full(cSprite_List& col_objects, const GL_Circle& circle, bool with_player = 0, const cSprite* exclude_sprite = NULL) const;
 
         // Update items drawing validation
         inline void Update_Items_Valid_Draw(void)
@@ -88,36 +119,48 @@ namespace TSC {
                 (*itr)->Update_Valid_Draw();
             }
         }
-        // Update items
-        inline void Update_Items(void)
-        {
-            for (cSprite_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
-                (*itr)->Update();
-            }
-        }
-        // Update_Late items
-        inline void Update_Items_Late(void)
-        {
-            for (cSprite_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
-                (*itr)->Update_Late();
-            }
-        }
-        // Draw items
-        inline void Draw_Items(void)
-        {
-            for (cSprite_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
-                (*itr)->Draw();
-            }
-        }
+        /* Update items
+         * if the active region is set only the items near the camera
+         * and the ones which can not sleep are updated in array order
+        */
+        void Update_Items(void);
+        // Update_Late items which were updated in Update_Items
+        void Update_Items_Late(void);
+        /* Draw items
+         * static sprites are drawn from the static layer if it is used
+        */
+        void Draw_Items(void);
+        // Save the positions of the dynamic items before a fixed step
+        void Save_Items_Step_Pos(void);
 
-        // Create Collision data and Handle the collisions
+        /* Create Collision data and Handle the collisions
+         * static sprites only handle their received collisions
+         * and sleeping sprites are skipped
+        */
         void Handle_Collision_Items(void);
 
+        /* Move a static sprite to the dynamic sprites
+         * called if something moves it while not editing
+        */
+        void Set_Dynamic(cSprite* sprite);
+        /* Handle the received collisions of the sprite in Handle_Collision_Items
+         * if it is static or sleeping, sleeping sprites are woken up
+        */
+        void Add_Received_Collision(cSprite* sprite);
+
 
         /* Return the current size
          * of the specified sprite array
          */
-        unsigned int Get_Size_Array(const ArrayType sprite_array);
+        unsigned int Get_Size_Array(const ArrayType sprite_array) const
+        {
+            return Get_Objects_by_Array(sprite_array).size();
+        }
+        // Return the current number of objects with the given type
+        unsigned int Get_Size_Type(const SpriteType type) const
+        {
+            return Get_Objects_by_Type(type).size();
+        }
 
         // Return object pointer if found
         cSprite* operator [](unsigned int identifier)
@@ -135,18 +178,51 @@ namespace TSC {
         // available uid is `new_max_uid_mark - 1'. This method does nothing
         // if `new_max_uid_mark' is smaller than the current max mark.
         void Allocate_UIDs(long new_max_uid_mark);
+        // Put the given UID back into the pool of available UIDs.
+        void Release_UID(int uid);
 
         typedef vector<float> ZposList;
         // biggest type z position
         ZposList m_z_pos_data;
         // biggest editor type z position
         ZposList m_z_pos_data_editor;
-        // This set holds the not-yet-used UIDs so we can easily
-        // find the next free one.
-        std::set<int> m_uid_pool;
+        // collision rect spatial index of the dynamic sprites
+        cSprite_Grid m_grid;
+        // collision rect spatial index of the static sprites
+        cSprite_Grid m_static_grid;
+        // cached geometry of the static sprites
+        cStatic_Layer m_static_layer;
+        // collision candidates of the moving sprites in Handle_Collision_Items
+        cBroad_Phase m_broad_phase;
+        // if set Handle_Collision_Items builds the broad phase
+        bool m_use_broad_phase;
+        /* if set cMovingSprite::Col_Move solves the movement with swept collision rects
+         * instead of moving in steps
+         * levels set it from the game_swept_collision preference
+        */
+        bool m_use_swept_collision;
+        /* distance around the camera in which sprites are updated
+         * sprites outside sleep until it reaches them again
+         * 0 updates all sprites
+        */
+        float m_active_region;
+        // Marks every UID below m_max_uid_mark that is taken. UID 0 is
+        // always taken.
+        std::vector<bool> m_uid_used;
+        // The sprite for every UID below m_max_uid_mark or NULL.
+        std::vector<cSprite*> m_uid_sprites;
+        // All UIDs below this one are taken. Generate_UID() starts
+        // searching here.
+        int m_uid_free_hint;
         // The UID pool is filled as needed. This is always the first
         // non-yet allocated UID.
         int m_max_uid_mark;
+        // Number of sprites added with an UID that already had a sprite
+        unsigned int m_uid_duplicates;
+
+        // Get_by_UID() calls
+        // only counted in the performance debug mode
+        mutable unsigned int m_uid_lookup_count;
 
         // Z position sort
         struct zpos_sort {
@@ -156,6 +232,14 @@ namespace TSC {
             }
         };
 
+        // sprite array position sort
+        struct array_num_sort {
+            bool operator()(const cSprite* a, const cSprite* b) const
+            {
+                return a->m_array_num < b->m_array_num;
+            }
+        };
+
         // Editor Z position sort
         struct editor_zpos_sort {
             bool operator()(const cSprite* a, const cSprite* b) const
@@ -193,6 +277,58 @@ namespace TSC {
          * are ensured to be placed in front of older ones.
          */
         void Ensure_Different_Z(cSprite* sprite);
+        /* Return true if the sprite never moves and needs no updates
+         * only plain not animated level sprites
+        */
+        bool Can_Be_Static(const cSprite* sprite) const;
+        // Add the sprite to the grids and sprite lists
+        void Add_To_Indices(cSprite* sprite);
+        // Remove the sprite from the grids and sprite lists
+        void Remove_From_Indices(cSprite* sprite);
+        // Add the array numbers of the sprites in this manager
+        void Add_Array_Nums(std::vector<size_t>& nums, const cSprite_List& sprites) const;
+        // Add the array numbers of the sprites which were updated in the last Update_Items
+        void Add_Awake_Array_Nums(std::vector<size_t>& nums, const cSprite_List& sprites) const;
+        // Collide and handle the collisions of the sprite
+        void Handle_Collision_Item(cSprite* obj);
+        /* Return true if the sprite may sleep outside of the active region
+         * spawned sprites and sprites with a larger update range never sleep
+        */
+        bool Can_Sleep(const cSprite* sprite) const;
+        // Remove the sprite from the given list
+        static void Remove_From_List(cSprite_List& sprites, cSprite* sprite);
+        // Add/Remove the sprite from the UID index
+        void Add_UID_Index(cSprite* sprite);
+        void Remove_UID_Index(cSprite* sprite);
+        // Reset the UID pool and index
+        void Reset_UIDs(void);
+        // Add/Remove the sprite from the type and array lists
+        void Add_Type_Index(cSprite* sprite);
+        void Remove_Type_Index(cSprite* sprite);
+        // Set the array number of the objects from start to end
+        void Update_Array_Nums(size_t start, size_t end);
+
+        // sprites which are not static
+        cSprite_List m_dynamic_objects;
+        // sprites which never sleep
+        cSprite_List m_awake_objects;
+        // static and woken up sprites which received collisions
+        cSprite_List m_received_collisions;
+        // Update_Items buffers
+        cSprite_List m_update_candidates;
+        std::vector<size_t> m_update_nums;
+        // Update_Items call counter, sprites with another stamp are sleeping
+        unsigned int m_update_stamp;
+        // objects by type and array
+        std::vector<cSprite_List> m_type_objects;
+        std::vector<cSprite_List> m_array_objects;
+        // returned for types and arrays without objects
+        static const cSprite_List m_empty_list;
+
+#ifdef TSC_SPRITE_GRID_CHECK
+        // Print the differences between the grid and the full scan results
+        void Check_Grid_Result(const cSprite_List& grid_objects, const cSprite_List& full_objects, const char* query) const;
+#endif
     };
 
     /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
@@ -0,0 +1,349 @@
+/***************************************************************************
+ * static_layer.cpp  -  cached geometry of the static sprites
+ *
+ * Copyright © 2013 - 2014 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../core/static_layer.hpp"
+#include "../core/game_core.hpp"
+#include "../core/camera.hpp"
+#include "../objects/sprite.hpp"
+#include "../video/gl_surface.hpp"
+#include "../video/renderer.hpp"
+
+using namespace std;
+
+namespace TSC {
+
+/* *** *** *** *** *** *** cStatic_Layer *** *** *** *** *** *** *** *** *** *** *** */
+
+// chunk coordinates are clamped to this to avoid overflows with broken positions
+static const int static_chunk_limit = 1 << 24;
+
+// sort sprites by their z position
+struct static_layer_zpos_sort {
+    bool operator()(const cSprite* a, const cSprite* b) const
+    {
+        return a->m_pos_z < b->m_pos_z;
+    }
+};
+
+unsigned int cStatic_Layer::m_images_loaded = 0;
+
+cStatic_Layer::cStatic_Layer(float chunk_size /* = 512.0f */)
+    : m_chunk_size(chunk_size)
+{
+    m_used = 0;
+    m_loaded_stamp = m_images_loaded;
+}
+
+cStatic_Layer::~cStatic_Layer(void)
+{
+    Clear();
+}
+
+bool cStatic_Layer::Can_Be_Cached(const cSprite* sprite)
+{
+    // only the sprite manager knows if it never moves
+    if (!sprite->m_static) {
+        return 0;
+    }
+
+    // the cached vertices are in level coordinates
+    if (sprite->m_no_camera) {
+        return 0;
+    }
+
+    // would need another render state
+    if (sprite->m_combine_type || sprite->m_shadow_pos) {
+        return 0;
+    }
+
+    // the texture is not known yet
+    if (sprite->m_image && sprite->m_image->m_loading) {
+        return 0;
+    }
+
+    return 1;
+}
+
+void cStatic_Layer::Add(cSprite* sprite)
+{
+    if (!sprite) {
+        return;
+    }
+
+    if (!Can_Be_Cached(sprite)) {
+        // added again when the texture is uploaded
+        if (sprite->m_static && sprite->m_image && sprite->m_image->m_loading &&
+            std::find(m_loading_sprites.begin(), m_loading_sprites.end(), sprite) == m_loading_sprites.end()) {
+            m_loading_sprites.push_back(sprite);
+        }
+
+        return;
+    }
+
+    cStatic_Layer_Entry& entry = sprite->m_static_layer_entry;
+
+    // already cached
+    if (entry.m_layer == this) {
+        Invalidate(sprite);
+        return;
+    }
+
+    entry.m_layer = this;
+    entry.m_x = Get_Chunk(sprite->m_pos_x);
+    entry.m_y = Get_Chunk(sprite->m_pos_y);
+
+    cChunk& chunk = m_chunks[Chunk_Key(entry.m_x, entry.m_y)];
+    chunk.m_sprites.push_back(sprite);
+    chunk.m_dirty = 1;
+}
+
+void cStatic_Layer::Remove(cSprite* sprite)
+{
+    if (!sprite) {
+        return;
+    }
+
+    vector<cSprite*>::iterator litr = std::find(m_loading_sprites.begin(), m_loading_sprites.end(), sprite);
+
+    if (litr != m_loading_sprites.end()) {
+        m_loading_sprites.erase(litr);
+    }
+
+    if (sprite->m_static_layer_entry.m_layer != this) {
+        return;
+    }
+
+    cStatic_Layer_Entry& entry = sprite->m_static_layer_entry;
+    Chunk_Map::iterator itr = m_chunks.find(Chunk_Key(entry.m_x, entry.m_y));
+
+    if (itr != m_chunks.end()) {
+        cChunk& chunk = itr->second;
+        vector<cSprite*>::iterator sitr = std::find(chunk.m_sprites.begin(), chunk.m_sprites.end(), sprite);
+
+        if (sitr != chunk.m_sprites.end()) {
+            chunk.m_sprites.erase(sitr);
+        }
+
+        if (chunk.m_sprites.empty()) {
+            m_chunks.erase(itr);
+        }
+        else {
+            chunk.m_dirty = 1;
+        }
+    }
+
+    entry = cStatic_Layer_Entry();
+}
+
+void cStatic_Layer::Invalidate(cSprite* sprite)
+{
+    if (!sprite) {
+        return;
+    }
+
+    cStatic_Layer_Entry& entry = sprite->m_static_layer_entry;
+
+    // not cached yet
+    if (entry.m_layer != this) {
+        Add(sprite);
+        return;
+    }
+
+    // can no longer be cached
+    if (!Can_Be_Cached(sprite)) {
+        Remove(sprite);
+        // waits if the new image is still loading
+        Add(sprite);
+        return;
+    }
+
+    Chunk_Map::iterator itr = m_chunks.find(Chunk_Key(entry.m_x, entry.m_y));
+
+    if (itr != m_chunks.end()) {
+        itr->second.m_dirty = 1;
+    }
+}
+
+void cStatic_Layer::Invalidate_All(const vector<cSprite*>& sprites)
+{
+    // positions may have changed so every sprite gets a new chunk
+    Clear();
+
+    for (vector<cSprite*>::const_iterator itr = sprites.begin(); itr != sprites.end(); ++itr) {
+        Add(*itr);
+    }
+}
+
+void cStatic_Layer::Clear(void)
+{
+    for (Chunk_Map::iterator itr = m_chunks.begin(); itr != m_chunks.end(); ++itr) {
+        vector<cSprite*>& sprites = itr->second.m_sprites;
+
+        for (vector<cSprite*>::iterator sitr = sprites.begin(); sitr != sprites.end(); ++sitr) {
+            (*sitr)->m_static_layer_entry = cStatic_Layer_Entry();
+        }
+    }
+
+    m_chunks.clear();
+    m_loading_sprites.clear();
+}
+
+void cStatic_Layer::Image_Loaded(void)
+{
+    m_images_loaded++;
+}
+
+bool cStatic_Layer::Draw(const vector<cSprite*>& sprites)
+{
+    // the editor draws the start positions and the debug mode adds the collision rects
+    if (editor_enabled || game_debug) {
+        m_used = 0;
+        return 0;
+    }
+
+    // sprites may have been changed in the editor
+    if (!m_used) {
+        Invalidate_All(sprites);
+        m_used = 1;
+        m_loaded_stamp = m_images_loaded;
+    }
+    // only the chunks of the sprites with a loaded image are rebuilt
+    else if (m_loaded_stamp != m_images_loaded) {
+        Add_Loaded_Sprites();
+        m_loaded_stamp = m_images_loaded;
+    }
+
+    const GL_rect camera_rect(pActive_Camera->m_x, pActive_Camera->m_y, game_res_w, game_res_h);
+
+    for (Chunk_Map::iterator itr = m_chunks.begin(); itr != m_chunks.end(); ++itr) {
+        cChunk& chunk = itr->second;
+
+        if (chunk.m_dirty) {
+            Build(chunk);
+        }
+
+        if (chunk.m_groups.empty() || !chunk.m_rect.Intersects(camera_rect)) {
+            continue;
+        }
+
+        for (vector<cGroup>::const_iterator gitr = chunk.m_groups.begin(); gitr != chunk.m_groups.end(); ++gitr) {
+            const cGroup& group = (*gitr);
+
+            cStatic_Request* request = new cStatic_Request();
+            request->m_texture_id = group.m_texture_id;
+            request->m_pos_z = group.m_pos_z;
+            request->m_vertices = group.m_vertices;
+            pRenderer->Add(request);
+        }
+    }
+
+    return 1;
+}
+
+void cStatic_Layer::Add_Loaded_Sprites(void)
+{
+    vector<cSprite*> waiting;
+    waiting.swap(m_loading_sprites);
+
+    for (vector<cSprite*>::iterator itr = waiting.begin(); itr != waiting.end(); ++itr) {
+        Add(*itr);
+    }
+}
+
+int cStatic_Layer::Get_Chunk(float pos) const
+{
+    const float chunk = floor(pos / m_chunk_size);
+
+    // also catches NaN
+    if (!(chunk > -static_chunk_limit)) {
+        return -static_chunk_limit;
+    }
+    if (chunk > static_chunk_limit) {
+        return static_chunk_limit;
+    }
+
+    return static_cast<int>(chunk);
+}
+
+void cStatic_Layer::Build(cChunk& chunk) const
+{
+    chunk.m_groups.clear();
+    chunk.m_dirty = 0;
+
+    // drawn in the same order as the renderer would sort them
+    vector<cSprite*> sprites = chunk.m_sprites;
+    std::stable_sort(sprites.begin(), sprites.end(), static_layer_zpos_sort());
+
+    // vertices are shared with the requests so new lists are created
+    vector<boost::shared_ptr<RenderVertexList> > group_vertices;
+
+    for (vector<cSprite*>::const_iterator itr = sprites.begin(); itr != sprites.end(); ++itr) {
+        const cSprite* sprite = (*itr);
+
+        // not drawn
+        if (!sprite->m_active || !sprite->m_image || sprite->m_auto_destroy) {
+            continue;
+        }
+
+        // same data as a drawn sprite but without camera and global scale
+        cSurface_Request request;
+        sprite->Draw_Image_Normal(&request);
+        request.m_no_camera = 1;
+        request.m_global_scale = 0;
+
+        /* new group if the texture or massive type changes
+         * joining an earlier group would draw its sprites before the ones in between
+        */
+        if (chunk.m_groups.empty() || chunk.m_groups.back().m_texture_id != request.m_texture_id || chunk.m_groups.back().m_massive_type != sprite->m_massive_type) {
+            cGroup group;
+            group.m_texture_id = request.m_texture_id;
+            group.m_massive_type = sprite->m_massive_type;
+            group.m_pos_z = request.m_pos_z;
+            chunk.m_groups.push_back(group);
+            group_vertices.push_back(boost::shared_ptr<RenderVertexList>(new RenderVertexList()));
+        }
+
+        request.Add_Batch_Vertices(*group_vertices.back());
+    }
+
+    float x1 = 0.0f, y1 = 0.0f, x2 = 0.0f, y2 = 0.0f;
+    bool first = 1;
+
+    for (unsigned int i = 0; i < chunk.m_groups.size(); i++) {
+        const RenderVertexList& vertices = *group_vertices[i];
+
+        for (RenderVertexList::const_iterator vitr = vertices.begin(); vitr != vertices.end(); ++vitr) {
+            if (first) {
+                x1 = x2 = vitr->m_x;
+                y1 = y2 = vitr->m_y;
+                first = 0;
+                continue;
+            }
+
+            x1 = std::min(x1, vitr->m_x);
+            y1 = std::min(y1, vitr->m_y);
+            x2 = std::max(x2, vitr->m_x);
+            y2 = std::max(y2, vitr->m_y);
+        }
+
+        chunk.m_groups[i].m_vertices = group_vertices[i];
+    }
+
+    chunk.m_rect = GL_rect(x1, y1, x2 - x1, y2 - y1);
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
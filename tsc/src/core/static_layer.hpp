@@ -0,0 +1,138 @@
+/***************************************************************************
+ * static_layer.h  -  cached geometry of the static sprites
+ *
+ * Copyright © 2013 - 2014 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_STATIC_LAYER_HPP
+#define TSC_STATIC_LAYER_HPP
+
+#include "../core/global_basic.hpp"
+#include "../core/global_game.hpp"
+#include "../core/math/rect.hpp"
+#include "../video/renderer.hpp"
+
+namespace TSC {
+
+    /* *** *** *** *** *** cStatic_Layer_Entry *** *** *** *** *** *** *** *** *** *** *** *** */
+
+    /* Static layer bookkeeping stored in every sprite
+     * only the layer itself should modify this
+    */
+    struct cStatic_Layer_Entry {
+        cStatic_Layer_Entry(void)
+            : m_layer(NULL), m_x(0), m_y(0) {};
+
+        // layer the sprite is cached in or NULL
+        cStatic_Layer* m_layer;
+        // chunk
+        int m_x;
+        int m_y;
+    };
+
+    /* *** *** *** *** *** cStatic_Layer *** *** *** *** *** *** *** *** *** *** *** *** */
+
+    /* Prebuilt vertices of the static sprites in chunks
+     * Every chunk is drawn with one request for each run of sprites with the same
+     * massive type and texture in the z order and is only rebuilt if one of its sprites changes.
+     * Not used in the editor and the debug mode as they draw every sprite on its own.
+    */
+    class cStatic_Layer {
+    public:
+        cStatic_Layer(float chunk_size = 512.0f);
+        ~cStatic_Layer(void);
+
+        // Return true if the static sprite can be drawn from the cached geometry
+        static bool Can_Be_Cached(const cSprite* sprite);
+
+        // Add the sprite to the chunk at its position if it can be cached
+        void Add(cSprite* sprite);
+        // Remove the sprite if it is cached in this layer
+        void Remove(cSprite* sprite);
+        /* Rebuild the chunk of the sprite
+         * it is added or removed if it changed if it can be cached
+        */
+        void Invalidate(cSprite* sprite);
+        /* Add all sprites again and rebuild every chunk
+         * sprites : all sprites of the manager, sprites which could not be cached before are added if they can be now
+        */
+        void Invalidate_All(const std::vector<cSprite*>& sprites);
+        // Remove all sprites
+        void Clear(void);
+        /* Add the sprites waiting for a loading image in the next Draw of every layer
+         * called if a loading image got its texture as its sprites can be cached now
+        */
+        static void Image_Loaded(void);
+
+        /* Add the requests of the chunks visible in the active camera
+         * sprites : all sprites of the manager, needed to rebuild the layer after the editor
+         * returns false if the cached geometry is not used and the sprites have to be drawn
+        */
+        bool Draw(const std::vector<cSprite*>& sprites);
+
+        // Return the number of used chunks
+        size_t Get_Chunk_Count(void) const
+        {
+            return m_chunks.size();
+        }
+
+        // chunk width and height
+        const float m_chunk_size;
+
+    private:
+        // vertices of sprites next to each other in the z order with the same texture and massive type
+        struct cGroup {
+            GLuint m_texture_id;
+            MassiveType m_massive_type;
+            // z position of the first sprite
+            float m_pos_z;
+            RenderVertexListPtr m_vertices;
+        };
+
+        struct cChunk {
+            cChunk(void)
+                : m_dirty(1) {};
+
+            std::vector<cSprite*> m_sprites;
+            std::vector<cGroup> m_groups;
+            // bounds of all vertices
+            GL_rect m_rect;
+            // if the groups need to be rebuilt
+            bool m_dirty;
+        };
+
+        typedef std::pair<int, int> Chunk_Key;
+        typedef boost::unordered_map<Chunk_Key, cChunk> Chunk_Map;
+
+        // Return the chunk coordinate for the given position
+        int Get_Chunk(float pos) const;
+        // Build the groups from the chunk sprites
+        void Build(cChunk& chunk) const;
+        // Add the waiting sprites again, the ones with a still loading image keep waiting
+        void Add_Loaded_Sprites(void);
+
+        Chunk_Map m_chunks;
+        // if the cached geometry was used in the last draw
+        bool m_used;
+        // static sprites which can not be cached until their image is loaded
+        std::vector<cSprite*> m_loading_sprites;
+        // the waiting sprites are added again if it differs from m_images_loaded
+        unsigned int m_loaded_stamp;
+        // changed by Image_Loaded
+        static unsigned int m_images_loaded;
+    };
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
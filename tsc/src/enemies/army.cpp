@@ -416,16 +416,14 @@ void cArmy::Stand_Up(void)
     // get space needed to stand up
     float move_y = m_image->m_col_h - (m_walk_start >= 0 ? m_images[m_walk_start].m_image->m_col_h : 0);
 
-    cObjectCollisionType* col_list = Collision_Check_Relative(0.0f, move_y, 0.0f, 0.0f, COLLIDE_ONLY_BLOCKING);
+    cObjectCollisionType col_list;
+    Collision_Check_Relative(col_list, 0.0f, move_y, 0.0f, 0.0f, COLLIDE_ONLY_BLOCKING);
 
     // failed to stand up because something is blocking
-    if (!col_list->empty()) {
-        delete col_list;
+    if (!col_list.empty()) {
         return;
     }
 
-    delete col_list;
-
     pAudio->Play_Sound("enemy/army/stand_up.wav");
     Col_Move(0.0f, move_y, 1, 1);
     Set_Army_Moving_State(ARMY_WALK);
@@ -159,9 +159,9 @@ void cEnemy::Update_Late(void)
 
         // handle collisions manually
         m_massive_type = MASS_MASSIVE;
-        cObjectCollisionType* col_list = Collision_Check(&m_col_rect);
-        Add_Collisions(col_list, 1);
-        delete col_list;
+        cObjectCollisionType col_list;
+        Collision_Check(col_list, &m_col_rect);
+        Add_Collisions(&col_list, 1);
         Handle_Collisions();
         m_massive_type = MASS_PASSIVE;
     }
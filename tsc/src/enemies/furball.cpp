@@ -186,6 +186,7 @@ void cFurball::Set_Color(const DefaultColor& col)
     else if (m_color_type == COL_BLACK) {
         filename_dir = "boss";
         m_type = TYPE_FURBALL_BOSS;
+        m_sprite_manager->Update_Type_Index(this);
 
         m_kill_points = 2500;
         m_fire_resistant = 1;
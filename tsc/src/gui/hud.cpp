@@ -776,17 +776,16 @@ void cItemBox::Update(void)
         Reset();
     }
 
-    cObjectCollisionType* col_list = m_item->Collision_Check(&m_item->m_col_rect, COLLIDE_ONLY_BLOCKING);
+    cObjectCollisionType col_list;
+    m_item->Collision_Check(col_list, &m_item->m_col_rect, COLLIDE_ONLY_BLOCKING);
 
     // if colliding with the player
-    if (col_list->Is_Included(TYPE_PLAYER)) {
+    if (col_list.Is_Included(TYPE_PLAYER)) {
         // player can send an item back
         SpriteType item_id_temp = m_item_id;
         Reset();
         pLevel_Player->Get_Item(item_id_temp, 1);
     }
-
-    delete col_list;
 }
 
 void cItemBox::Draw(cSurface_Request* request /* = NULL */)
@@ -897,13 +896,19 @@ cDebugDisplay::cDebugDisplay(cSprite_Manager* sprite_manager)
     m_enemy_counter = -1;
     m_active_counter = -1;
 
-    // debug text window
-    m_window_debug_text = CEGUI::WindowManager::getSingleton().loadWindowLayout("debugtext.layout");
-    pGuiSystem->getGUISheet()->addChildWindow(m_window_debug_text);
-    // debug text
-    m_text_debug_text = static_cast<CEGUI::Window*>(CEGUI::WindowManager::getSingleton().getWindow("text_debugmessage"));
-    // hide
-    m_text_debug_text->setVisible(0);
+    m_window_debug_text = NULL;
+    m_text_debug_text = NULL;
+
+    // the gui is not initialized in the headless mode
+    if (pGuiSystem) {
+        // debug text window
+        m_window_debug_text = CEGUI::WindowManager::getSingleton().loadWindowLayout("debugtext.layout");
+        pGuiSystem->getGUISheet()->addChildWindow(m_window_debug_text);
+        // debug text
+        m_text_debug_text = static_cast<CEGUI::Window*>(CEGUI::WindowManager::getSingleton().getWindow("text_debugmessage"));
+        // hide
+        m_text_debug_text->setVisible(0);
+    }
 
     // debug box positions
     float tempx = static_cast<float>(game_res_w) - 200.0f;
@@ -943,8 +948,10 @@ cDebugDisplay::cDebugDisplay(cSprite_Manager* sprite_manager)
 
 cDebugDisplay::~cDebugDisplay(void)
 {
-    pGuiSystem->getGUISheet()->removeChildWindow(m_window_debug_text);
-    CEGUI::WindowManager::getSingleton().destroyWindow(m_window_debug_text);
+    if (m_window_debug_text) {
+        pGuiSystem->getGUISheet()->removeChildWindow(m_window_debug_text);
+        CEGUI::WindowManager::getSingleton().destroyWindow(m_window_debug_text);
+    }
 
     for (HudSpriteList::iterator itr = m_sprites.begin(); itr != m_sprites.end(); ++itr) {
         delete *itr;
@@ -956,7 +963,7 @@ cDebugDisplay::~cDebugDisplay(void)
 void cDebugDisplay::Update(void)
 {
     // no text to display
-    if (m_text.empty()) {
+    if (m_text.empty() || !m_text_debug_text) {
         return;
     }
 
@@ -1107,8 +1114,10 @@ void cDebugDisplay::Draw_Debug_Mode(void)
 
         // Halfmassive
         unsigned int halfmassive = 0;
+        // only set with the active array
+        const cSprite_List& active_objects = m_sprite_manager->Get_Objects_by_Array(ARRAY_ACTIVE);
 
-        for (cSprite_List::const_iterator itr = m_sprite_manager->objects.begin(); itr != m_sprite_manager->objects.end(); ++itr) {
+        for (cSprite_List::const_iterator itr = active_objects.begin(); itr != active_objects.end(); ++itr) {
             // get object pointer
             const cSprite* obj = (*itr);
 
@@ -1121,55 +1130,30 @@ void cDebugDisplay::Draw_Debug_Mode(void)
         m_sprites[11]->Set_Image(pFont->Render_Text(pFont->m_font_very_small, temp_text, white), 0, 1);
 
         // Moving Platform
-        unsigned int moving_platform = 0;
-
-        for (cSprite_List::const_iterator itr = m_sprite_manager->objects.begin(); itr != m_sprite_manager->objects.end(); ++itr) {
-            // get object pointer
-            const cSprite* obj = (*itr);
-
-            if (obj->m_type == TYPE_MOVING_PLATFORM) {
-                moving_platform++;
-            }
-        }
+        unsigned int moving_platform = m_sprite_manager->Get_Size_Type(TYPE_MOVING_PLATFORM);
 
         temp_text = _("Moving Platform : ") + int_to_string(moving_platform);
         m_sprites[12]->Set_Image(pFont->Render_Text(pFont->m_font_very_small, temp_text, white), 0, 1);
 
-        // Goldbox
+        // Goldbox and Bonusbox
         unsigned int goldbox = 0;
+        unsigned int bonusbox_count = 0;
+        const cSprite_List& bonusbox_objects = m_sprite_manager->Get_Objects_by_Type(TYPE_BONUS_BOX);
 
-        for (cSprite_List::const_iterator itr = m_sprite_manager->objects.begin(); itr != m_sprite_manager->objects.end(); ++itr) {
-            // get object pointer
-            const cSprite* obj = (*itr);
-
-            if (obj->m_type == TYPE_BONUS_BOX) {
-                const cBonusBox* bonusbox = static_cast<const cBonusBox*>(obj);
+        for (cSprite_List::const_iterator itr = bonusbox_objects.begin(); itr != bonusbox_objects.end(); ++itr) {
+            const cBonusBox* bonusbox = static_cast<const cBonusBox*>(*itr);
 
-                if (bonusbox->box_type == TYPE_GOLDPIECE) {
-                    goldbox++;
-                }
+            if (bonusbox->box_type == TYPE_GOLDPIECE) {
+                goldbox++;
+            }
+            else {
+                bonusbox_count++;
             }
         }
 
         temp_text = _("Goldbox : ") + int_to_string(goldbox);
         m_sprites[13]->Set_Image(pFont->Render_Text(pFont->m_font_very_small, temp_text, white), 0, 1);
 
-        // Bonusbox
-        unsigned int bonusbox_count = 0;
-
-        for (cSprite_List::const_iterator itr = m_sprite_manager->objects.begin(); itr != m_sprite_manager->objects.end(); ++itr) {
-            // get object pointer
-            const cSprite* obj = (*itr);
-
-            if (obj->m_type == TYPE_BONUS_BOX) {
-                const cBonusBox* bonusbox = static_cast<const cBonusBox*>(obj);
-
-                if (bonusbox->box_type != TYPE_GOLDPIECE) {
-                    bonusbox_count++;
-                }
-            }
-        }
-
         temp_text = _("Bonusbox : ") + int_to_string(bonusbox_count);
         m_sprites[14]->Set_Image(pFont->Render_Text(pFont->m_font_very_small, temp_text, white), 0, 1);
 
@@ -1222,7 +1206,7 @@ void cDebugDisplay::Draw_Performance_Debug_Mode(void)
 
     // black background
     Color color = blackalpha128;
-    pVideo->Draw_Rect(15, ypos, 190, 390, m_pos_z - 0.00001f, &color);
+    pVideo->Draw_Rect(15, ypos, 190, 402, m_pos_z - 0.00001f, &color);
 
     // don't draw it twice
     if (!game_debug) {
@@ -1325,6 +1309,15 @@ void cDebugDisplay::Draw_Performance_Debug_Mode(void)
     text_strings.push_back(_("Game : ") + int_to_string(pFramerate->m_perf_timer[PERF_RENDER_GAME]->ms));
     text_strings.push_back(_("Gui : ") + int_to_string(pFramerate->m_perf_timer[PERF_RENDER_GUI]->ms));
     text_strings.push_back(_("Buffer : ") + int_to_string(pFramerate->m_perf_timer[PERF_RENDER_BUFFER]->ms));
+    text_strings.push_back(_("Draw calls : ") + int_to_string(pRenderer->m_draw_calls));
+    // sprites
+    const cSprite_Manager* sprite_manager = pActive_Level->m_sprite_manager;
+    text_strings.push_back(_("Sprites"));
+    text_strings.push_back(_("UID lookups : ") + int_to_string(sprite_manager->m_uid_lookup_count));
+    // images
+    text_strings.push_back(_("Images"));
+    text_strings.push_back(_("Path hits : ") + long_to_string(pImage_Manager->m_path_hits));
+    text_strings.push_back(_("Path misses : ") + long_to_string(pImage_Manager->m_path_misses));
 
     unsigned int pos = 0;
 
@@ -1334,11 +1327,11 @@ void cDebugDisplay::Draw_Performance_Debug_Mode(void)
         ypos += 12;
 
         // move non header a bit to the right right
-        if (pos != 0 && pos != 7 && pos != 17) {
+        if (pos != 0 && pos != 7 && pos != 17 && pos != 22) {
             xpos += 10;
         }
         // if new group starts move a bit more down
-        if (pos == 7 || pos == 17) {
+        if (pos == 7 || pos == 17 || pos == 22) {
             ypos += 10;
         }
 
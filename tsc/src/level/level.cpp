@@ -106,6 +106,8 @@ cLevel::cLevel(void)
 #endif
 
     m_sprite_manager = new cSprite_Manager();
+    m_sprite_manager->m_active_region = static_cast<float>(pPreferences->m_active_region);
+    m_sprite_manager->m_use_swept_collision = pPreferences->m_swept_collision;
     m_background_manager = new cBackground_Manager();
     m_animation_manager = new cAnimation_Manager();
 
@@ -18,6 +18,7 @@
 #include "../user/preferences.hpp"
 #include "../core/game_core.hpp"
 #include "../video/gl_surface.hpp"
+#include "../video/renderer.hpp"
 #include "../core/framerate.hpp"
 #include "../core/filesystem/resource_manager.hpp"
 #include "../core/filesystem/package_manager.hpp"
@@ -72,6 +73,12 @@ void cBackground::Init(void)
     m_speed_y = 0.5f;
     m_const_vel_x = 0.0f;
     m_const_vel_y = 0.0f;
+
+    m_tile_image = NULL;
+    m_tile_texture_id = 0;
+    m_tile_columns = 0;
+    m_tile_rows = 0;
+    m_tile_pos_z = 0.0f;
 }
 
 void cBackground::Load_From_Attributes(XmlAttributes& attributes)
@@ -264,7 +271,11 @@ void cBackground::Draw(void)
     // image
     else if (m_type == BG_IMG_BOTTOM || m_type == BG_IMG_TOP || m_type == BG_IMG_ALL) {
         // if background images are disabled or no image
-        if (!pPreferences->m_level_background_images || !m_image_1) {
+        if (!pPreferences->m_level_background_images || !m_image_1 || m_image_1->m_w <= 0.0f || m_image_1->m_h <= 0.0f) {
+            return;
+        }
+        // still loaded in the background
+        if (m_image_1->m_loading || !m_image_1->m_image) {
             return;
         }
 
@@ -297,27 +308,57 @@ void cBackground::Draw(void)
             }
         }
 
-        // draw until width is filled
-        while (posx_final < game_res_w) {
-            // draw horizontal
-            m_image_1->Blit(posx_final, posy_final, m_pos_z);
+        /* enough tiles to fill the screen from any aligned start position
+         * the tiles are cached and drawn with one request
+        */
+        const unsigned int columns = static_cast<unsigned int>(ceil(game_res_w / m_image_1->m_w)) + 1;
+        unsigned int rows = 1;
 
-            // draw vertical
-            if (m_type == BG_IMG_ALL) {
-                float posy_temp = posy_final;
+        if (m_type == BG_IMG_ALL) {
+            rows = static_cast<unsigned int>(ceil(game_res_h / m_image_1->m_h)) + 1;
+        }
 
-                // draw until height is filled
-                while (posy_temp < game_res_h - m_image_1->m_h) {
-                    // change position first as this position y is already drawn
-                    posy_temp += m_image_1->m_h;
+        Update_Tiles(columns, rows);
 
-                    m_image_1->Blit(posx_final, posy_temp, m_pos_z);
-                }
-            }
+        cStatic_Request* request = new cStatic_Request();
+        request->m_no_camera = 1;
+        request->m_texture_id = m_tile_texture_id;
+        request->m_pos_x = posx_final;
+        request->m_pos_y = posy_final;
+        request->m_pos_z = m_pos_z;
+        request->m_vertices = m_tile_vertices;
+        pRenderer->Add(request);
+    }
+}
 
-            posx_final += m_image_1->m_w;
+void cBackground::Update_Tiles(unsigned int columns, unsigned int rows)
+{
+    // still valid
+    if (m_tile_vertices && m_tile_image == m_image_1 && m_tile_texture_id == m_image_1->m_image &&
+        m_tile_columns == columns && m_tile_rows == rows && Is_Float_Equal(m_tile_pos_z, m_pos_z)) {
+        return;
+    }
+
+    // the previous vertices may still be used by the render thread
+    boost::shared_ptr<RenderVertexList> vertices(new RenderVertexList());
+    vertices->reserve(columns * rows * 4);
+
+    for (unsigned int column = 0; column < columns; column++) {
+        for (unsigned int row = 0; row < rows; row++) {
+            // global scale is set in the request
+            cSurface_Request tile;
+            m_image_1->Blit(column * m_image_1->m_w, row * m_image_1->m_h, m_pos_z, &tile);
+            tile.m_global_scale = 0;
+            tile.Add_Batch_Vertices(*vertices);
         }
     }
+
+    m_tile_vertices = vertices;
+    m_tile_image = m_image_1;
+    m_tile_texture_id = m_image_1->m_image;
+    m_tile_columns = columns;
+    m_tile_rows = rows;
+    m_tile_pos_z = m_pos_z;
 }
 
 void cBackground::Draw_Gradient(void)
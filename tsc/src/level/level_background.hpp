@@ -19,6 +19,7 @@
 
 #include "../core/global_basic.hpp"
 #include "../video/video.hpp"
+#include "../video/renderer.hpp"
 #include "../video/img_set.hpp"
 #include "../core/obj_manager.hpp"
 
@@ -121,6 +122,21 @@ namespace TSC {
         // colors
         Color m_color_1;
         Color m_color_2;
+
+    private:
+        /* Build the image tiles vertices if the image or the tile count changed
+         * columns/rows : number of tiles
+        */
+        void Update_Tiles(unsigned int columns, unsigned int rows);
+
+        // - cached image tiles
+        RenderVertexListPtr m_tile_vertices;
+        // image and tile count the vertices were built for
+        const cGL_Surface* m_tile_image;
+        GLuint m_tile_texture_id;
+        unsigned int m_tile_columns;
+        unsigned int m_tile_rows;
+        float m_tile_pos_z;
     };
 
     /* *** *** *** *** *** cBackground_Manager *** *** *** *** *** *** *** *** *** *** *** *** */
@@ -28,6 +28,7 @@
 #include "../level/level_player.hpp"
 #include "../core/filesystem/filesystem.hpp"
 #include "../core/filesystem/resource_manager.hpp"
+#include "../core/filesystem/package_manager.hpp"
 #include "../core/editor/editor_items_loader.hpp"
 #include "level_loader.hpp"
 
@@ -393,6 +394,9 @@ void cEditor_Level::Function_Reload(void)
         return;
     }
 
+    // resources may have been added or changed
+    pPackage_Manager->Rescan_Resources();
+
     // Simulate level ending followed by loading the level from scratch
     // (cf. cLevel_Manager::Finish_Level)
     Game_Action = GA_ENTER_LEVEL;
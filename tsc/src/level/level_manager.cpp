@@ -130,7 +130,21 @@ cLevel* cLevel_Manager::Load(std::string levelname , bool loading_sublevel /* =
 
     // load
     fs::path filename = Get_Path(levelname);
-    level = cLevel::Load_From_File(filename);
+    // decode the level images in the background
+    pVideo->m_queue_surfaces = 1;
+
+    try {
+        level = cLevel::Load_From_File(filename);
+    }
+    catch (...) {
+        pVideo->m_queue_surfaces = 0;
+        pVideo->Finish_Async_Surfaces();
+        throw;
+    }
+
+    // and upload them before the level is entered
+    pVideo->m_queue_surfaces = 0;
+    pVideo->Finish_Async_Surfaces();
 
     Add(level);
     return level;
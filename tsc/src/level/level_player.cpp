@@ -442,12 +442,13 @@ void cLevel_Player::Move_Player(float velocity, float vel_wrongway)
     }
 
     // get collision list
-    cObjectCollisionType* col_list = Collision_Check_Relative(velocity, 0.0f, 0.0f, 0.0f, COLLIDE_ONLY_BLOCKING);
+    cObjectCollisionType col_list;
+    Collision_Check_Relative(col_list, velocity, 0.0f, 0.0f, 0.0f, COLLIDE_ONLY_BLOCKING);
     // if collision with a blocking object
     bool is_col = 0;
 
     // check collisions
-    for (cObjectCollision_List::iterator itr = col_list->objects.begin(); itr != col_list->objects.end(); ++itr) {
+    for (cObjectCollision_List::iterator itr = col_list.objects.begin(); itr != col_list.objects.end(); ++itr) {
         cObjectCollision* col_obj = (*itr);
 
         // massive object is blocking
@@ -457,8 +458,6 @@ void cLevel_Player::Move_Player(float velocity, float vel_wrongway)
         }
     }
 
-    delete col_list;
-
     // don't move if colliding
     if (is_col) {
         if (Is_Float_Equal(m_velx, 0.0f)) {
@@ -886,22 +885,20 @@ void cLevel_Player::Start_Falling(void)
     const float move_y = 1.9f;
 
     // check if something else is now blocking
-    cObjectCollisionType* col_list = Collision_Check_Relative(0.0f, move_y, 0.0f, 0.0f, COLLIDE_ONLY_BLOCKING);
+    cObjectCollisionType col_list;
+    Collision_Check_Relative(col_list, 0.0f, move_y, 0.0f, 0.0f, COLLIDE_ONLY_BLOCKING);
 
     // check possible new ground objects
-    for (cObjectCollision_List::iterator itr = col_list->objects.begin(); itr != col_list->objects.end(); ++itr) {
+    for (cObjectCollision_List::iterator itr = col_list.objects.begin(); itr != col_list.objects.end(); ++itr) {
         cObjectCollision* col_obj = (*itr);
 
         // blocked by new ground object
         if (col_obj->m_obj != m_ground_object && col_obj->m_obj->m_can_be_ground) {
             Set_On_Ground(col_obj->m_obj);
-            delete col_list;
             return;
         }
     }
 
-    delete col_list;
-
     // fall through ground object
     Move(0.0f, move_y, 1);
     Set_Moving_State(STA_FALL);
@@ -968,18 +965,16 @@ void cLevel_Player::Stop_Ducking(void)
     // get space needed to stand up
     const float move_y = -(m_images[ALEX_IMG_STAND].m_image->m_col_h - m_image->m_col_h);
 
-    cObjectCollisionType* col_list = Collision_Check_Relative(0.0f, move_y, 0.0f, 0.0f, COLLIDE_ONLY_BLOCKING);
+    cObjectCollisionType col_list;
+    Collision_Check_Relative(col_list, 0.0f, move_y, 0.0f, 0.0f, COLLIDE_ONLY_BLOCKING);
 
     // failed to stand up because something is blocking
-    if (col_list->size()) {
+    if (col_list.size()) {
         // set ducked time again to stop possible power jump while in air
         m_ducked_counter = 1;
-        delete col_list;
         return;
     }
 
-    delete col_list;
-
     // unset ducking image ( without Check_out_of_Level from cMovingSprite )
     cSprite::Move(0.0f, move_y, 1);
     Set_Image_Num(ALEX_IMG_STAND + m_direction);
@@ -1107,20 +1102,19 @@ bool cLevel_Player::Is_On_Climbable(float move_y /* = 0.0f */)
     climb_rect.m_h = 4.0f;
 
     // collision testing
-    cObjectCollisionType* col_list = Collision_Check(&climb_rect, COLLIDE_ONLY_INTERNAL);
+    cObjectCollisionType col_list;
+    Collision_Check(col_list, &climb_rect, COLLIDE_ONLY_INTERNAL);
 
     // check objects
-    for (cObjectCollision_List::iterator itr = col_list->objects.begin(); itr != col_list->objects.end(); ++itr) {
+    for (cObjectCollision_List::iterator itr = col_list.objects.begin(); itr != col_list.objects.end(); ++itr) {
         cObjectCollision* col_obj = (*itr);
 
         // collision with climbable object
         if (col_obj->m_obj->m_massive_type == MASS_CLIMBABLE) {
-            delete col_list;
             return 1;
         }
     }
 
-    delete col_list;
     return 0;
 }
 
@@ -1346,10 +1340,11 @@ void cLevel_Player::Update_Item(void)
         }
 
         // check the next player position for objects
-        cObjectCollisionType* col_list = Collision_Check_Relative((m_direction == DIR_LEFT) ? (check_x) : (m_col_rect.m_w), 0, (m_direction == DIR_LEFT) ? (-check_x) : (check_x));
+        cObjectCollisionType col_list;
+        Collision_Check_Relative(col_list, (m_direction == DIR_LEFT) ? (check_x) : (m_col_rect.m_w), 0, (m_direction == DIR_LEFT) ? (-check_x) : (check_x));
 
         // possible objects
-        for (cObjectCollision_List::iterator itr = col_list->objects.begin(); itr != col_list->objects.end(); ++itr) {
+        for (cObjectCollision_List::iterator itr = col_list.objects.begin(); itr != col_list.objects.end(); ++itr) {
             cObjectCollision* col = (*itr);
 
             // enemy item
@@ -1373,8 +1368,6 @@ void cLevel_Player::Update_Item(void)
             }
             // other items here...
         }
-
-        delete col_list;
     }
 }
 
@@ -1484,25 +1477,23 @@ void cLevel_Player::Release_Item(bool set_position /* = 1 */, bool no_action /*
 
         // set step size
         float step_size = 0.0f;
-        cObjectCollisionType* col_list = NULL;
+        cObjectCollisionType col_list;
 
         // check for a valid position to release the object
         while (step_size < 50.0f) {
-            if (col_list) {
-                delete col_list;
-            }
+            col_list.Delete_All();
 
             // check left side
-            col_list = m_active_object->Collision_Check_Relative(step_size, 0.0f, 0.0f, 0.0f, COLLIDE_ONLY_BLOCKING);
+            m_active_object->Collision_Check_Relative(col_list, step_size, 0.0f, 0.0f, 0.0f, COLLIDE_ONLY_BLOCKING);
 
             // collides with a blocking object on the left side
-            if (!col_list->empty() && (col_list->Is_Included(ARRAY_MASSIVE) || col_list->Is_Included(ARRAY_ACTIVE) || col_list->Is_Included(ARRAY_ENEMY))) {
-                delete col_list;
+            if (!col_list.empty() && (col_list.Is_Included(ARRAY_MASSIVE) || col_list.Is_Included(ARRAY_ACTIVE) || col_list.Is_Included(ARRAY_ENEMY))) {
+                col_list.Delete_All();
                 // check right side
-                col_list = m_active_object->Collision_Check_Relative(-step_size, 0.0f, 0.0f, 0.0f, COLLIDE_ONLY_BLOCKING);
+                m_active_object->Collision_Check_Relative(col_list, -step_size, 0.0f, 0.0f, 0.0f, COLLIDE_ONLY_BLOCKING);
 
                 // also collides on the right side
-                if (!col_list->empty() && (col_list->Is_Included(ARRAY_MASSIVE) || col_list->Is_Included(ARRAY_ACTIVE) || col_list->Is_Included(ARRAY_ENEMY))) {
+                if (!col_list.empty() && (col_list.Is_Included(ARRAY_MASSIVE) || col_list.Is_Included(ARRAY_ACTIVE) || col_list.Is_Included(ARRAY_ENEMY))) {
                     // continue moving
                 }
                 else {
@@ -1521,12 +1512,12 @@ void cLevel_Player::Release_Item(bool set_position /* = 1 */, bool no_action /*
         }
 
         // check if still blocking objects on the final position
-        if (!col_list->empty() && (col_list->Is_Included(ARRAY_MASSIVE) || col_list->Is_Included(ARRAY_ACTIVE) || col_list->Is_Included(ARRAY_ENEMY))) {
+        if (!col_list.empty() && (col_list.Is_Included(ARRAY_MASSIVE) || col_list.Is_Included(ARRAY_ACTIVE) || col_list.Is_Included(ARRAY_ENEMY))) {
             if (m_active_object->m_type == TYPE_ARMY || m_active_object->m_type == TYPE_SHELL) {
                 // shell
                 if (m_active_object->m_state == STA_RUN) {
                     // if collision with static blocking objects
-                    if (col_list->Is_Included(ARRAY_MASSIVE) || col_list->Is_Included(ARRAY_ACTIVE)) {
+                    if (col_list.Is_Included(ARRAY_MASSIVE) || col_list.Is_Included(ARRAY_ACTIVE)) {
                         m_active_object->DownGrade(1);
                     }
                 }
@@ -1537,8 +1528,6 @@ void cLevel_Player::Release_Item(bool set_position /* = 1 */, bool no_action /*
                 }
             }
         }
-
-        delete col_list;
     }
 
     m_active_object->Clear_Collisions();
@@ -1743,20 +1732,18 @@ bool cLevel_Player::Change_Size(float x, float y, bool only_check /* = 0 */)
     }
 
     while (!valid_hor) {
-        cObjectCollisionType* col_list = Collision_Check_Relative(check_pos, 0.0f, 0.0f, 0.0f, COLLIDE_ONLY_BLOCKING);
+        cObjectCollisionType col_list;
+        Collision_Check_Relative(col_list, check_pos, 0.0f, 0.0f, 0.0f, COLLIDE_ONLY_BLOCKING);
 
-        if (col_list->empty()) {
+        if (col_list.empty()) {
             if (!only_check) {
                 Col_Move(check_pos, 0.0f, 1, 1);
             }
 
             valid_hor = 1;
-            delete col_list;
             break;
         }
 
-        delete col_list;
-
         // move to opposite direction
         if (x > 0.0f) {
             check_pos--;
@@ -1785,20 +1772,18 @@ bool cLevel_Player::Change_Size(float x, float y, bool only_check /* = 0 */)
     }
 
     while (!valid_ver) {
-        cObjectCollisionType* col_list = Collision_Check_Relative(0.0f, check_pos, 0.0f, 0.0f, COLLIDE_ONLY_BLOCKING);
+        cObjectCollisionType col_list;
+        Collision_Check_Relative(col_list, 0.0f, check_pos, 0.0f, 0.0f, COLLIDE_ONLY_BLOCKING);
 
-        if (col_list->empty()) {
+        if (col_list.empty()) {
             if (!only_check) {
                 Col_Move(0.0f, check_pos, 1, 1);
             }
 
             valid_ver = 1;
-            delete col_list;
             break;
         }
 
-        delete col_list;
-
         // move to opposite direction
         if (y > 0.0f) {
             check_pos--;
@@ -2900,12 +2885,28 @@ void cLevel_Player::Action_Jump(bool enemy_jump /* = 0 */)
     Update_Jump_Keytime();
 }
 
-void cLevel_Player::Action_Interact(input_identifier key_type)
+void cLevel_Player::Get_Interact_Objects(cSprite_List& col_objects, bool with_climbable) const
 {
-    // Up
-    if (key_type == INP_UP) {
-        // Search for colliding level exit objects
-        for (cSprite_List::iterator itr = m_sprite_manager->objects.begin(); itr != m_sprite_manager->objects.end(); ++itr) {
+    const cSprite_List& level_exits = m_sprite_manager->Get_Objects_by_Type(TYPE_LEVEL_EXIT);
+
+    for (cSprite_List::const_iterator itr = level_exits.begin(); itr != level_exits.end(); ++itr) {
+        cSprite* obj = (*itr);
+
+        // skip destroyed objects
+        if (obj->m_auto_destroy) {
+            continue;
+        }
+
+        if (m_col_rect.Intersects(obj->m_col_rect)) {
+            col_objects.push_back(obj);
+        }
+    }
+
+    if (with_climbable) {
+        // climbable objects are always in the active array
+        const cSprite_List& active_objects = m_sprite_manager->Get_Objects_by_Array(ARRAY_ACTIVE);
+
+        for (cSprite_List::const_iterator itr = active_objects.begin(); itr != active_objects.end(); ++itr) {
             cSprite* obj = (*itr);
 
             // skip destroyed objects
@@ -2913,10 +2914,32 @@ void cLevel_Player::Action_Interact(input_identifier key_type)
                 continue;
             }
 
-            if (!m_col_rect.Intersects(obj->m_col_rect)) {
+            // level exits are already added
+            if (obj->m_type == TYPE_LEVEL_EXIT || obj->m_massive_type != MASS_CLIMBABLE) {
                 continue;
             }
 
+            if (m_col_rect.Intersects(obj->m_col_rect)) {
+                col_objects.push_back(obj);
+            }
+        }
+    }
+
+    // the lists are not in array order
+    std::sort(col_objects.begin(), col_objects.end(), cSprite_Manager::array_num_sort());
+}
+
+void cLevel_Player::Action_Interact(input_identifier key_type)
+{
+    // Up
+    if (key_type == INP_UP) {
+        cSprite_List col_objects;
+        Get_Interact_Objects(col_objects, 1);
+
+        // Search for colliding level exit and climbable objects
+        for (cSprite_List::iterator itr = col_objects.begin(); itr != col_objects.end(); ++itr) {
+            cSprite* obj = (*itr);
+
             // level exit
             if (obj->m_type == TYPE_LEVEL_EXIT) {
                 cLevel_Exit* level_exit = static_cast<cLevel_Exit*>(obj);
@@ -2954,37 +2977,27 @@ void cLevel_Player::Action_Interact(input_identifier key_type)
     }
     // Down
     else if (key_type == INP_DOWN) {
+        cSprite_List col_objects;
+        Get_Interact_Objects(col_objects, 0);
+
         // Search for colliding level exit objects
-        for (cSprite_List::iterator itr = m_sprite_manager->objects.begin(); itr != m_sprite_manager->objects.end(); ++itr) {
+        for (cSprite_List::iterator itr = col_objects.begin(); itr != col_objects.end(); ++itr) {
             cSprite* obj = (*itr);
+            cLevel_Exit* level_exit = static_cast<cLevel_Exit*>(obj);
 
-            // skip destroyed objects
-            if (obj->m_auto_destroy) {
-                continue;
-            }
-
-            if (!m_col_rect.Intersects(obj->m_col_rect)) {
-                continue;
-            }
-
-            // level exit
-            if (obj->m_type == TYPE_LEVEL_EXIT) {
-                cLevel_Exit* level_exit = static_cast<cLevel_Exit*>(obj);
-
-                // warp
-                if (level_exit->m_exit_type == LEVEL_EXIT_WARP) {
-                    if (level_exit->m_direction == DIR_DOWN) {
-                        // needs to be on ground
-                        if (m_ground_object) {
-                            Game_Action = GA_ACTIVATE_LEVEL_EXIT;
-                            Game_Action_ptr = level_exit;
+            // warp
+            if (level_exit->m_exit_type == LEVEL_EXIT_WARP) {
+                if (level_exit->m_direction == DIR_DOWN) {
+                    // needs to be on ground
+                    if (m_ground_object) {
+                        Game_Action = GA_ACTIVATE_LEVEL_EXIT;
+                        Game_Action_ptr = level_exit;
 
-                            // if leaving level
-                            if (level_exit->m_dest_level.empty() && level_exit->m_dest_entry.empty()) {
-                                Game_Action_Data_Start.add("music_fadeout", "1000");
-                            }
-                            return;
+                        // if leaving level
+                        if (level_exit->m_dest_level.empty() && level_exit->m_dest_entry.empty()) {
+                            Game_Action_Data_Start.add("music_fadeout", "1000");
                         }
+                        return;
                     }
                 }
             }
@@ -3004,35 +3017,25 @@ void cLevel_Player::Action_Interact(input_identifier key_type)
     }
     // Left
     else if (key_type == INP_LEFT) {
+        cSprite_List col_objects;
+        Get_Interact_Objects(col_objects, 0);
+
         // Search for colliding level exit objects
-        for (cSprite_List::iterator itr = m_sprite_manager->objects.begin(); itr != m_sprite_manager->objects.end(); ++itr) {
+        for (cSprite_List::iterator itr = col_objects.begin(); itr != col_objects.end(); ++itr) {
             cSprite* obj = (*itr);
+            cLevel_Exit* level_exit = static_cast<cLevel_Exit*>(obj);
 
-            // skip destroyed objects
-            if (obj->m_auto_destroy) {
-                continue;
-            }
-
-            if (!m_col_rect.Intersects(obj->m_col_rect)) {
-                continue;
-            }
-
-            // level exit
-            if (obj->m_type == TYPE_LEVEL_EXIT) {
-                cLevel_Exit* level_exit = static_cast<cLevel_Exit*>(obj);
-
-                // warp
-                if (level_exit->m_exit_type == LEVEL_EXIT_WARP) {
-                    if (level_exit->m_direction == DIR_LEFT) {
-                        if (m_velx >= 0) {
-                            Game_Action = GA_ACTIVATE_LEVEL_EXIT;
-                            Game_Action_ptr = level_exit;
-                            // if leaving level
-                            if (level_exit->m_dest_level.empty() && level_exit->m_dest_entry.empty()) {
-                                Game_Action_Data_Start.add("music_fadeout", "1000");
-                            }
-                            return;
+            // warp
+            if (level_exit->m_exit_type == LEVEL_EXIT_WARP) {
+                if (level_exit->m_direction == DIR_LEFT) {
+                    if (m_velx >= 0) {
+                        Game_Action = GA_ACTIVATE_LEVEL_EXIT;
+                        Game_Action_ptr = level_exit;
+                        // if leaving level
+                        if (level_exit->m_dest_level.empty() && level_exit->m_dest_entry.empty()) {
+                            Game_Action_Data_Start.add("music_fadeout", "1000");
                         }
+                        return;
                     }
                 }
             }
@@ -3052,35 +3055,25 @@ void cLevel_Player::Action_Interact(input_identifier key_type)
     }
     // Right
     else if (key_type == INP_RIGHT) {
+        cSprite_List col_objects;
+        Get_Interact_Objects(col_objects, 0);
+
         // Search for colliding level exit objects
-        for (cSprite_List::iterator itr = m_sprite_manager->objects.begin(); itr != m_sprite_manager->objects.end(); ++itr) {
+        for (cSprite_List::iterator itr = col_objects.begin(); itr != col_objects.end(); ++itr) {
             cSprite* obj = (*itr);
+            cLevel_Exit* level_exit = static_cast<cLevel_Exit*>(obj);
 
-            // skip destroyed objects
-            if (obj->m_auto_destroy) {
-                continue;
-            }
-
-            if (!m_col_rect.Intersects(obj->m_col_rect)) {
-                continue;
-            }
-
-            // level exit
-            if (obj->m_type == TYPE_LEVEL_EXIT) {
-                cLevel_Exit* level_exit = static_cast<cLevel_Exit*>(obj);
-
-                // warp
-                if (level_exit->m_exit_type == LEVEL_EXIT_WARP) {
-                    if (level_exit->m_direction == DIR_RIGHT) {
-                        if (m_velx <= 0) {
-                            Game_Action = GA_ACTIVATE_LEVEL_EXIT;
-                            Game_Action_ptr = level_exit;
-                            // if leaving level
-                            if (level_exit->m_dest_level.empty() && level_exit->m_dest_entry.empty()) {
-                                Game_Action_Data_Start.add("music_fadeout", "1000");
-                            }
-                            return;
+            // warp
+            if (level_exit->m_exit_type == LEVEL_EXIT_WARP) {
+                if (level_exit->m_direction == DIR_RIGHT) {
+                    if (m_velx <= 0) {
+                        Game_Action = GA_ACTIVATE_LEVEL_EXIT;
+                        Game_Action_ptr = level_exit;
+                        // if leaving level
+                        if (level_exit->m_dest_level.empty() && level_exit->m_dest_entry.empty()) {
+                            Game_Action_Data_Start.add("music_fadeout", "1000");
                         }
+                        return;
                     }
                 }
             }
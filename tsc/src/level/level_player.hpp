@@ -203,6 +203,10 @@ namespace TSC {
 
         // Start a jump
         void Action_Jump(bool enemy_jump = 0);
+        /* Add the colliding level exits and optionally the climbable objects
+         * sorted by their array number
+        */
+        void Get_Interact_Objects(cSprite_List& col_objects, bool with_climbable) const;
         // General input interact event
         void Action_Interact(input_identifier key_type);
         // Shoot if available
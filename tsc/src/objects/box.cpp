@@ -357,18 +357,17 @@ void cBaseBox::Check_Collision(ObjectDirection col_direction)
     }
 
     // collision count
-    cObjectCollisionType* col_list = Collision_Check_Relative(check_x, check_y, m_col_rect.m_w - (check_x * 0.5f), m_col_rect.m_h - (check_y * 0.5f));
+    cObjectCollisionType col_list;
+    Collision_Check_Relative(col_list, check_x, check_y, m_col_rect.m_w - (check_x * 0.5f), m_col_rect.m_h - (check_y * 0.5f));
 
     // handle collisions
-    for (cObjectCollision_List::iterator itr = col_list->objects.begin(); itr != col_list->objects.end(); ++itr) {
+    for (cObjectCollision_List::iterator itr = col_list.objects.begin(); itr != col_list.objects.end(); ++itr) {
         cObjectCollision* col_obj = (*itr);
 
         // send box collision
         col_obj->m_obj->Handle_Collision_Box(Get_Opposite_Direction(col_obj->m_direction), &m_col_rect);
 
     }
-
-    delete col_list;
 }
 
 void cBaseBox::Activate(void)
@@ -79,6 +79,8 @@ void cLevel_Entry::Init(void)
     m_start_rect.m_w = m_rect.m_w;
     m_start_rect.m_h = m_rect.m_h;
 
+    Update_Collision_Index();
+
     m_entry_type = LEVEL_ENTRY_WARP;
     Set_Direction(DIR_UP);
 
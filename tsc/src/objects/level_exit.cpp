@@ -114,6 +114,8 @@ void cLevel_Exit::Init(void)
     m_start_rect.m_w = m_rect.m_w;
     m_start_rect.m_h = m_rect.m_h;
 
+    Update_Collision_Index();
+
     m_exit_type = LEVEL_EXIT_BEAM;
     m_exit_motion = CAMERA_MOVE_FLY;
 
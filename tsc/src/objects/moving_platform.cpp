@@ -112,6 +112,8 @@ void cMoving_Platform::Init(void)
     m_can_be_on_ground = 0;
 
     m_camera_range = 3000;
+    // must stay in sync with its path and linked platforms
+    m_disallow_sleep = 1;
     m_can_be_ground = 1;
 
     m_move_type = MOVING_PLATFORM_TYPE_LINE;
@@ -785,6 +787,8 @@ void cMoving_Platform::Update_Rect(void)
     // set height
     m_col_rect.m_h = m_rect.m_h;
     m_start_rect.m_h = m_rect.m_h;
+
+    Update_Collision_Index();
 }
 
 void cMoving_Platform::Update_Velocity(void)
@@ -28,6 +28,7 @@
 #include "../video/renderer.hpp"
 #include "../video/gl_surface.hpp"
 #include "../core/sprite_manager.hpp"
+#include "../core/benchmark.hpp"
 
 namespace TSC {
 
@@ -228,15 +229,18 @@ void cMovingSprite::Move(float move_x, float move_y, bool real /* = 0 */)
     Check_And_Handle_Out_Of_Level(move_x, move_y);
 }
 
-cObjectCollisionType* cMovingSprite::Col_Move_in_Steps(float move_x, float move_y, float step_size_x, float step_size_y, float final_pos_x, float final_pos_y, cSprite_List sprite_list, bool stop_on_internal /* = 0 */)
+void cMovingSprite::Col_Move_in_Steps(cObjectCollisionType& col_list, float move_x, float move_y, float step_size_x, float step_size_y, float final_pos_x, float final_pos_y, const cSprite_List& sprite_list, bool stop_on_internal /* = 0 */)
 {
     if (sprite_list.empty()) {
         cSprite::Move(final_pos_x - m_pos_x, final_pos_y - m_pos_y, 1);
-        return NULL;
+        return;
     }
 
-    // collision list
-    cObjectCollisionType* col_list = new cObjectCollisionType();
+    // collisions of the current step
+    cObjectCollisionType col_list_temp;
+    // objects to check, only copied if internal collisions are removed
+    const cSprite_List* check_list = &sprite_list;
+    cSprite_List remaining_list;
 
     bool move_x_valid = 1;
     bool move_y_valid = 1;
@@ -253,24 +257,24 @@ cObjectCollisionType* cMovingSprite::Col_Move_in_Steps(float move_x, float move_
             }
 
             // collision check
-            cObjectCollisionType* col_list_temp = Collision_Check_Relative(step_size_x, 0.0f, 0.0f, 0.0f, COLLIDE_COMPLETE, &sprite_list);
+            Collision_Check_Relative(col_list_temp, step_size_x, 0.0f, 0.0f, 0.0f, COLLIDE_COMPLETE, check_list);
 
             bool collision_found = 0;
 
             // stop on everything
             if (stop_on_internal) {
-                if (col_list_temp->size()) {
+                if (col_list_temp.size()) {
                     collision_found = 1;
                 }
             }
             // stop only on blocking
             else {
-                if (col_list_temp->Is_Included(COL_VTYPE_BLOCKING)) {
+                if (col_list_temp.Is_Included(COL_VTYPE_BLOCKING)) {
                     collision_found = 1;
                 }
                 // remove internal collision from further checks
-                else if (col_list_temp->objects.size()) {
-                    for (cObjectCollision_List::iterator itr = col_list_temp->objects.begin(); itr != col_list_temp->objects.end(); ++itr) {
+                else if (col_list_temp.objects.size()) {
+                    for (cObjectCollision_List::iterator itr = col_list_temp.objects.begin(); itr != col_list_temp.objects.end(); ++itr) {
                         cObjectCollision* col = (*itr);
 
                         if (col->m_valid_type != COL_VTYPE_INTERNAL) {
@@ -278,31 +282,38 @@ cObjectCollisionType* cMovingSprite::Col_Move_in_Steps(float move_x, float move_
                         }
 
                         // find in sprite list
-                        cSprite_List::iterator sprite_itr = std::find(sprite_list.begin(), sprite_list.end(), col->m_obj);
+                        cSprite_List::const_iterator sprite_itr = std::find(check_list->begin(), check_list->end(), col->m_obj);
 
                         // not found
-                        if (sprite_itr == sprite_list.end()) {
+                        if (sprite_itr == check_list->end()) {
                             continue;
                         }
 
-                        sprite_list.erase(sprite_itr);
+                        const size_t sprite_num = sprite_itr - check_list->begin();
+
+                        // first removal
+                        if (check_list != &remaining_list) {
+                            remaining_list = sprite_list;
+                            check_list = &remaining_list;
+                        }
+
+                        remaining_list.erase(remaining_list.begin() + sprite_num);
                     }
 
                     // if no objects left
-                    if (sprite_list.empty()) {
+                    if (check_list->empty()) {
                         // move to final position
                         m_pos_x = final_pos_x;
                     }
                 }
             }
 
-            if (col_list_temp->size()) {
-                col_list->objects.insert(col_list->objects.end(), col_list_temp->objects.begin(), col_list_temp->objects.end());
-                col_list_temp->objects.clear();
+            // move the collisions into the result
+            if (col_list_temp.size()) {
+                col_list.objects.insert(col_list.objects.end(), col_list_temp.objects.begin(), col_list_temp.objects.end());
+                col_list_temp.objects.clear();
             }
 
-            delete col_list_temp;
-
             if (!collision_found) {
                 m_pos_x += step_size_x;
 
@@ -330,24 +341,24 @@ cObjectCollisionType* cMovingSprite::Col_Move_in_Steps(float move_x, float move_
             }
 
             // collision check
-            cObjectCollisionType* col_list_temp = Collision_Check_Relative(0.0f, step_size_y, 0.0f, 0.0f, COLLIDE_COMPLETE, &sprite_list);
+            Collision_Check_Relative(col_list_temp, 0.0f, step_size_y, 0.0f, 0.0f, COLLIDE_COMPLETE, check_list);
 
             bool collision_found = 0;
 
             // stop on everything
             if (stop_on_internal) {
-                if (col_list_temp->size()) {
+                if (col_list_temp.size()) {
                     collision_found = 1;
                 }
             }
             // stop only on blocking
             else {
-                if (col_list_temp->Is_Included(COL_VTYPE_BLOCKING)) {
+                if (col_list_temp.Is_Included(COL_VTYPE_BLOCKING)) {
                     collision_found = 1;
                 }
                 // remove internal collision from further checks
-                else if (col_list_temp->objects.size()) {
-                    for (cObjectCollision_List::iterator itr = col_list_temp->objects.begin(); itr != col_list_temp->objects.end(); ++itr) {
+                else if (col_list_temp.objects.size()) {
+                    for (cObjectCollision_List::iterator itr = col_list_temp.objects.begin(); itr != col_list_temp.objects.end(); ++itr) {
                         cObjectCollision* col = (*itr);
 
                         if (col->m_valid_type != COL_VTYPE_INTERNAL) {
@@ -355,17 +366,25 @@ cObjectCollisionType* cMovingSprite::Col_Move_in_Steps(float move_x, float move_
                         }
 
                         // find in sprite list
-                        cSprite_List::iterator sprite_itr = std::find(sprite_list.begin(), sprite_list.end(), col->m_obj);
+                        cSprite_List::const_iterator sprite_itr = std::find(check_list->begin(), check_list->end(), col->m_obj);
 
                         // not found
-                        if (sprite_itr == sprite_list.end()) {
+                        if (sprite_itr == check_list->end()) {
                             continue;
                         }
 
-                        sprite_list.erase(sprite_itr);
+                        const size_t sprite_num = sprite_itr - check_list->begin();
+
+                        // first removal
+                        if (check_list != &remaining_list) {
+                            remaining_list = sprite_list;
+                            check_list = &remaining_list;
+                        }
+
+                        remaining_list.erase(remaining_list.begin() + sprite_num);
 
                         // if no objects left
-                        if (sprite_list.empty()) {
+                        if (check_list->empty()) {
                             // move to final position
                             m_pos_y = final_pos_y;
                         }
@@ -373,13 +392,12 @@ cObjectCollisionType* cMovingSprite::Col_Move_in_Steps(float move_x, float move_
                 }
             }
 
-            if (col_list_temp->size()) {
-                col_list->objects.insert(col_list->objects.end(), col_list_temp->objects.begin(), col_list_temp->objects.end());
-                col_list_temp->objects.clear();
+            // move the collisions into the result
+            if (col_list_temp.size()) {
+                col_list.objects.insert(col_list.objects.end(), col_list_temp.objects.begin(), col_list_temp.objects.end());
+                col_list_temp.objects.clear();
             }
 
-            delete col_list_temp;
-
             if (!collision_found) {
                 m_pos_y += step_size_y;
 
@@ -399,12 +417,295 @@ cObjectCollisionType* cMovingSprite::Col_Move_in_Steps(float move_x, float move_
             }
         }
     }
+}
+
+void cMovingSprite::Col_Move_Stepped(cObjectCollisionType& col_list, float move_x, float move_y, const cSprite_List& sprite_list)
+{
+    // step size
+    float step_size_x = move_x;
+    float step_size_y = move_y;
+
+    // check if object collision rect is smaller as the position check size
+    if (step_size_x > m_col_rect.m_w) {
+        step_size_x = m_col_rect.m_w;
+    }
+    else if (step_size_x < -m_col_rect.m_w) {
+        step_size_x = -m_col_rect.m_w;
+    }
+
+    if (step_size_y > m_col_rect.m_h) {
+        step_size_y = m_col_rect.m_h;
+    }
+    else if (step_size_y < -m_col_rect.m_h) {
+        step_size_y = -m_col_rect.m_h;
+    }
+
+    float final_pos_x = m_pos_x + move_x;
+    float final_pos_y = m_pos_y + move_y;
+
+    // move in big steps
+    Col_Move_in_Steps(col_list, move_x, move_y, step_size_x, step_size_y, final_pos_x, final_pos_y, sprite_list, 1);
+
+    // no collision found
+    if (!col_list.size()) {
+        return;
+    }
+
+    // change to pixel checking
+    if (step_size_x < -1.0f) {
+        step_size_x = -1.0f;
+    }
+    else if (step_size_x > 1.0f) {
+        step_size_x = 1.0f;
+    }
+
+    if (step_size_y < -1.0f) {
+        step_size_y = -1.0f;
+    }
+    else if (step_size_y > 1.0f) {
+        step_size_y = 1.0f;
+    }
+
+    col_list.Delete_All();
+    Col_Move_in_Steps(col_list, move_x, move_y, step_size_x, step_size_y, final_pos_x, final_pos_y, sprite_list);
+}
+
+/* Return the movement time from 0 to 1 at which the rect starts to touch the other rect
+ * returns 0 or less if it already touches and more than 1 if it does not touch
+ * hit_x : set if it starts to touch in the horizontal direction
+*/
+static float Get_Sweep_Time(const GL_rect& rect, float move_x, float move_y, const GL_rect& other, bool& hit_x)
+{
+    // used for the never changing directions
+    const float sweep_infinity = 1.0e30f;
+
+    float enter_x, exit_x;
+
+    if (Is_Float_Equal(move_x, 0.0f)) {
+        if (rect.m_x + rect.m_w < other.m_x || rect.m_x > other.m_x + other.m_w) {
+            return 2.0f;
+        }
+
+        enter_x = -sweep_infinity;
+        exit_x = sweep_infinity;
+    }
+    else if (move_x > 0.0f) {
+        enter_x = (other.m_x - (rect.m_x + rect.m_w)) / move_x;
+        exit_x = (other.m_x + other.m_w - rect.m_x) / move_x;
+    }
+    else {
+        enter_x = (other.m_x + other.m_w - rect.m_x) / move_x;
+        exit_x = (other.m_x - (rect.m_x + rect.m_w)) / move_x;
+    }
+
+    float enter_y, exit_y;
+
+    if (Is_Float_Equal(move_y, 0.0f)) {
+        if (rect.m_y + rect.m_h < other.m_y || rect.m_y > other.m_y + other.m_h) {
+            return 2.0f;
+        }
+
+        enter_y = -sweep_infinity;
+        exit_y = sweep_infinity;
+    }
+    else if (move_y > 0.0f) {
+        enter_y = (other.m_y - (rect.m_y + rect.m_h)) / move_y;
+        exit_y = (other.m_y + other.m_h - rect.m_y) / move_y;
+    }
+    else {
+        enter_y = (other.m_y + other.m_h - rect.m_y) / move_y;
+        exit_y = (other.m_y - (rect.m_y + rect.m_h)) / move_y;
+    }
+
+    const float enter_time = std::max(enter_x, enter_y);
+    const float exit_time = std::min(exit_x, exit_y);
+
+    // does not touch in this movement
+    if (enter_time > exit_time || enter_time > 1.0f || exit_time < 0.0f) {
+        return 2.0f;
+    }
+
+    hit_x = enter_x > enter_y;
+    return enter_time;
+}
+
+/* Return the distance moving in pixel steps stops at
+ * before touching something in the given distance
+*/
+static float Get_Step_Distance(float move, float contact_distance)
+{
+    const float step_size = std::min(fabs(move), 1.0f);
+
+    if (step_size <= 0.0f) {
+        return 0.0f;
+    }
+
+    // the last step which does not touch
+    const float distance = std::min((ceil(contact_distance / step_size) - 1.0f) * step_size, static_cast<float>(fabs(move)));
+
+    if (distance <= 0.0f) {
+        return 0.0f;
+    }
+
+    return move > 0.0f ? distance : -distance;
+}
+
+void cMovingSprite::Col_Move_Swept(cObjectCollisionType& col_list, float move_x, float move_y, const GL_rect& complete_rect, const cSprite_List& sprite_list)
+{
+    // all possible collisions of the complete movement
+    cObjectCollisionType candidates;
+    Collision_Check(candidates, complete_rect, COLLIDE_COMPLETE, &sprite_list);
+
+    cObjectCollision_List& cols = candidates.objects;
+    // set if moved into the result
+    std::vector<bool> added(cols.size(), 0);
+    // blocking collisions of the current pass
+    std::vector<size_t> hits;
+
+    // every blocked pass stops at least one direction
+    for (unsigned int pass = 0; pass < 3; pass++) {
+        if (Is_Float_Equal(move_x, 0.0f) && Is_Float_Equal(move_y, 0.0f)) {
+            break;
+        }
+
+        const GL_rect start_rect = m_col_rect;
+        float hit_time = 1.0f;
+        bool block_x = 0;
+        bool block_y = 0;
+        hits.clear();
+
+        // find the first blocking collision
+        for (size_t i = 0; i < cols.size(); i++) {
+            const cObjectCollision* col = cols[i];
+
+            if (col->m_valid_type != COL_VTYPE_BLOCKING) {
+                continue;
+            }
+
+            const GL_rect& col_rect = col->m_obj->m_col_rect;
+            bool hit_x = 0;
+            float time = Get_Sweep_Time(start_rect, move_x, move_y, col_rect, hit_x);
+
+            if (time > 1.0f) {
+                continue;
+            }
+
+            bool hit_y = !hit_x;
+
+            // already touching : only blocks if the next step would still touch
+            if (time <= 0.0f) {
+                time = 0.0f;
+                GL_rect step_rect = start_rect;
+
+                step_rect.m_x += std::max(-1.0f, std::min(move_x, 1.0f));
+                hit_x = !Is_Float_Equal(move_x, 0.0f) && step_rect.Intersects(col_rect);
+                step_rect.m_x = start_rect.m_x;
+                step_rect.m_y += std::max(-1.0f, std::min(move_y, 1.0f));
+                hit_y = !Is_Float_Equal(move_y, 0.0f) && step_rect.Intersects(col_rect);
+
+                // moves away from it
+                if (!hit_x && !hit_y) {
+                    continue;
+                }
+            }
+
+            // earlier
+            if (hits.empty() || time < hit_time - 0.0001f) {
+                hits.clear();
+                hit_time = time;
+                block_x = hit_x;
+                block_y = hit_y;
+            }
+            // other direction at the same time
+            else if (Is_Float_Equal(time, hit_time)) {
+                block_x |= hit_x;
+                block_y |= hit_y;
+            }
+            else {
+                continue;
+            }
+
+            hits.push_back(i);
+        }
+
+        // internal collisions until the blocking one
+        for (size_t i = 0; i < cols.size(); i++) {
+            cObjectCollision* col = cols[i];
+
+            if (added[i] || col->m_valid_type == COL_VTYPE_BLOCKING) {
+                continue;
+            }
+
+            bool hit_x = 0;
+            float time = Get_Sweep_Time(start_rect, move_x, move_y, col->m_obj->m_col_rect, hit_x);
+
+            if (time > hit_time) {
+                continue;
+            }
+
+            // the direction is taken from the touching position
+            time = std::max(time, 0.0f);
+            m_col_rect.m_x = start_rect.m_x + move_x * time;
+            m_col_rect.m_y = start_rect.m_y + move_y * time;
+            col->Set_Direction(this, col->m_obj);
+            m_col_rect = start_rect;
+
+            col_list.objects.push_back(col);
+            added[i] = 1;
+        }
+
+        // move until the collision time and keep the step distance in the blocked directions
+        float dist_x = move_x * hit_time;
+        float dist_y = move_y * hit_time;
+
+        if (block_x) {
+            dist_x = Get_Step_Distance(move_x, fabs(move_x) * hit_time);
+        }
+        if (block_y) {
+            dist_y = Get_Step_Distance(move_y, fabs(move_y) * hit_time);
+        }
+
+        m_pos_x += dist_x;
+        m_pos_y += dist_y;
+        Update_Position_Rect();
+
+        // nothing blocked
+        if (hits.empty()) {
+            break;
+        }
+
+        // blocking collisions from the stopped position
+        for (std::vector<size_t>::const_iterator itr = hits.begin(); itr != hits.end(); ++itr) {
+            cObjectCollision* col = cols[*itr];
+
+            if (added[*itr]) {
+                continue;
+            }
+
+            col->Set_Direction(this, col->m_obj);
+            col_list.objects.push_back(col);
+            added[*itr] = 1;
+        }
+
+        // continue in the free direction
+        move_x = block_x ? 0.0f : move_x - dist_x;
+        move_y = block_y ? 0.0f : move_y - dist_y;
+    }
+
+    // delete the unused collisions
+    for (size_t i = 0; i < cols.size(); i++) {
+        if (!added[i]) {
+            delete cols[i];
+        }
+    }
 
-    return col_list;
+    cols.clear();
 }
 
 void cMovingSprite::Col_Move(float move_x, float move_y, bool real /* = 0 */, bool force /* = 0 */, bool check_on_ground /* = 1 */)
 {
+    TSC_BENCHMARK_SCOPE(pBenchmark_Col_Move);
+
     // no need to move
     if (Is_Float_Equal(move_x, 0.0f) && Is_Float_Equal(move_y, 0.0f)) {
         return;
@@ -445,57 +746,37 @@ void cMovingSprite::Col_Move(float move_x, float move_y, bool real /* = 0 */, bo
         cSprite_List sprite_list;
         m_sprite_manager->Get_Colliding_Objects(sprite_list, complete_rect, 1, this);
 
-        // step size
-        float step_size_x = move_x;
-        float step_size_y = move_y;
-
-        // check if object collision rect is smaller as the position check size
-        if (step_size_x > m_col_rect.m_w) {
-            step_size_x = m_col_rect.m_w;
-        }
-        else if (step_size_x < -m_col_rect.m_w) {
-            step_size_x = -m_col_rect.m_w;
-        }
-
-        if (step_size_y > m_col_rect.m_h) {
-            step_size_y = m_col_rect.m_h;
-        }
-        else if (step_size_y < -m_col_rect.m_h) {
-            step_size_y = -m_col_rect.m_h;
-        }
-
-        float final_pos_x = m_pos_x + move_x;
-        float final_pos_y = m_pos_y + move_y;
-
-        // move in big steps
-        cObjectCollisionType* col_list = Col_Move_in_Steps(move_x, move_y, step_size_x, step_size_y, final_pos_x, final_pos_y, sprite_list, 1);
-
-        // if a collision is found enter pixel checking
-        if (col_list && col_list->size()) {
-            // change to pixel checking
-            if (step_size_x < -1.0f) {
-                step_size_x = -1.0f;
+        cObjectCollisionType col_list;
+
+        // solve the movement at once
+        if (m_sprite_manager->m_use_swept_collision) {
+#ifdef TSC_SWEPT_COLLISION_CHECK
+            // the stepped movement from the same position
+            const float start_pos_x = m_pos_x;
+            const float start_pos_y = m_pos_y;
+            cObjectCollisionType step_col_list;
+            Col_Move_Stepped(step_col_list, move_x, move_y, sprite_list);
+            step_col_list.Delete_All();
+            const float step_pos_x = m_pos_x;
+            const float step_pos_y = m_pos_y;
+            m_pos_x = start_pos_x;
+            m_pos_y = start_pos_y;
+            Update_Position_Rect();
+#endif
+            Col_Move_Swept(col_list, move_x, move_y, complete_rect, sprite_list);
+
+#ifdef TSC_SWEPT_COLLISION_CHECK
+            if (!Is_Float_Equal(step_pos_x, m_pos_x, 0.01f) || !Is_Float_Equal(step_pos_y, m_pos_y, 0.01f)) {
+                cerr << "Warning : Swept collision moved " << Create_Name() << " to " << m_pos_x << ", " << m_pos_y << " but the steps to " << step_pos_x << ", " << step_pos_y << endl;
             }
-            else if (step_size_x > 1.0f) {
-                step_size_x = 1.0f;
-            }
-
-            if (step_size_y < -1.0f) {
-                step_size_y = -1.0f;
-            }
-            else if (step_size_y > 1.0f) {
-                step_size_y = 1.0f;
-            }
-
-            delete col_list;
-            col_list = Col_Move_in_Steps(move_x, move_y, step_size_x, step_size_y, final_pos_x, final_pos_y, sprite_list);
-
-            Add_Collisions(col_list, 1);
+#endif
         }
-
-        if (col_list) {
-            delete col_list;
+        // move in steps
+        else {
+            Col_Move_Stepped(col_list, move_x, move_y, sprite_list);
         }
+
+        Add_Collisions(&col_list, 1);
     }
     // don't check for collisions
     else {
@@ -641,7 +922,7 @@ void cMovingSprite::Draw(cSurface_Request* request /* = NULL */)
     }
 }
 
-cObjectCollisionType* cMovingSprite::Collision_Check_Absolute(const float x, const float y, const float w /* = 0 */, const float h /* = 0 */, const ColCheckType check_type /* = COLLIDE_COMPLETE */, cSprite_List* objects /* = NULL */)
+void cMovingSprite::Collision_Check_Absolute(cObjectCollisionType& col_list, const float x, const float y, const float w /* = 0 */, const float h /* = 0 */, const ColCheckType check_type /* = COLLIDE_COMPLETE */, const cSprite_List* objects /* = NULL */)
 {
     // save original rect
     GL_rect new_rect;
@@ -694,23 +975,26 @@ cObjectCollisionType* cMovingSprite::Collision_Check_Absolute(const float x, con
         pRenderer->Add(request);
     }
 
-    // return collisions list
-    return Collision_Check(&new_rect, check_type, objects);
+    // add collisions
+    Collision_Check(col_list, new_rect, check_type, objects);
 }
 
-cObjectCollisionType* cMovingSprite::Collision_Check(const GL_rect& new_rect, const ColCheckType check_type /* = COLLIDE_COMPLETE */, cSprite_List* objects /* = NULL */)
+void cMovingSprite::Collision_Check(cObjectCollisionType& col_list, const GL_rect& new_rect, const ColCheckType check_type /* = COLLIDE_COMPLETE */, const cSprite_List* objects /* = NULL */)
 {
-    // blocking collisions list
-    cObjectCollisionType* col_list = new cObjectCollisionType();
+    TSC_BENCHMARK_SCOPE(pBenchmark_Collision_Check);
 
     // no width or height is invalid
     if (Is_Float_Equal(new_rect.m_w, 0.0f) || Is_Float_Equal(new_rect.m_h, 0.0f)) {
-        return col_list;
+        return;
     }
 
-    // if no object list is given get all objects available
+    // nearby objects if no object list is given
+    cSprite_List nearby_objects;
+
+    // if no object list is given get all objects touching the rect
     if (!objects) {
-        objects = &m_sprite_manager->objects;
+        m_sprite_manager->Get_Colliding_Objects(nearby_objects, new_rect, 0, this);
+        objects = &nearby_objects;
 
         // Player
         if (m_type != TYPE_PLAYER && new_rect.Intersects(pActive_Player->m_col_rect)) {
@@ -733,13 +1017,13 @@ cObjectCollisionType* cMovingSprite::Collision_Check(const GL_rect& new_rect, co
             // valid collision
             if (col_valid != COL_VTYPE_NOT_VALID) {
                 // add to list
-                col_list->Add(Create_Collision_Object(this, pActive_Player, col_valid));
+                col_list.Add(Create_Collision_Object(this, pActive_Player, col_valid));
             }
         }
     }
 
     // Check objects
-    for (cSprite_List::iterator itr = objects->begin(); itr != objects->end(); ++itr) {
+    for (cSprite_List::const_iterator itr = objects->begin(); itr != objects->end(); ++itr) {
         // get object pointer
         cSprite* level_object = (*itr);
 
@@ -785,10 +1069,8 @@ cObjectCollisionType* cMovingSprite::Collision_Check(const GL_rect& new_rect, co
         }
 
         // add to list
-        col_list->Add(Create_Collision_Object(this, level_object, col_valid));
+        col_list.Add(Create_Collision_Object(this, level_object, col_valid));
     }
-
-    return col_list;
 }
 
 void cMovingSprite::Check_And_Handle_Out_Of_Level(const float move_x, const float move_y)
@@ -893,12 +1175,13 @@ void cMovingSprite::Check_on_Ground(void)
     }
 
     // new onground check
-    cObjectCollisionType* col_list = Collision_Check_Relative(0.0f, m_col_rect.m_h, 0.0f, 1.0f, COLLIDE_ONLY_BLOCKING);
+    cObjectCollisionType col_list;
+    Collision_Check_Relative(col_list, 0.0f, m_col_rect.m_h, 0.0f, 1.0f, COLLIDE_ONLY_BLOCKING);
 
     Reset_On_Ground();
 
     // possible ground objects
-    for (cObjectCollision_List::iterator itr = col_list->objects.begin(); itr != col_list->objects.end(); ++itr) {
+    for (cObjectCollision_List::iterator itr = col_list.objects.begin(); itr != col_list.objects.end(); ++itr) {
         cObjectCollision* col = (*itr);
 
         // ground collision found
@@ -910,17 +1193,16 @@ void cMovingSprite::Check_on_Ground(void)
             }
         }
     }
-
-    delete col_list;
 }
 
 void cMovingSprite::Update_Anti_Stuck(void)
 {
     // collision count
-    cObjectCollisionType* col_list = Collision_Check(&m_col_rect, COLLIDE_ONLY_BLOCKING);
+    cObjectCollisionType col_list;
+    Collision_Check(col_list, &m_col_rect, COLLIDE_ONLY_BLOCKING);
 
     // check collisions
-    for (cObjectCollision_List::iterator itr = col_list->objects.begin(); itr != col_list->objects.end(); ++itr) {
+    for (cObjectCollision_List::iterator itr = col_list.objects.begin(); itr != col_list.objects.end(); ++itr) {
         cObjectCollision* collision = (*itr);
         cSprite* col_obj = collision->m_obj;
 
@@ -943,8 +1225,6 @@ void cMovingSprite::Update_Anti_Stuck(void)
             Col_Move(0.0f, -1.0f, 0, 1);
         }
     }
-
-    delete col_list;
 }
 
 void cMovingSprite::Collide_Move(void)
@@ -1281,6 +1561,9 @@ void cMovingSprite::Send_Collision(const cObjectCollision* collision, bool handl
     // add collision to the list
     else {
         target_obj->Add_Collision(new_collision);
+
+        // static and sleeping sprites are only handled if they received collisions
+        m_sprite_manager->Add_Received_Collision(target_obj);
     }
 }
 
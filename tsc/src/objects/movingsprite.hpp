@@ -189,28 +189,28 @@ namespace TSC {
         virtual void Draw(cSurface_Request* request = NULL);
 
         /* Check if moving the current collision rect position with the given values is valid
+         * col_list : the found collisions are added to this list
          * check_type : set which collision types are added to the list
          * objects : if set check these object instead of all
-         * The collision data should be deleted if not used anymore
         */
-        cObjectCollisionType* Collision_Check_Relative(const float x, const float y, const float w = 0.0f, const float h = 0.0f, const ColCheckType check_type = COLLIDE_COMPLETE, cSprite_List* objects = NULL)
+        void Collision_Check_Relative(cObjectCollisionType& col_list, const float x, const float y, const float w = 0.0f, const float h = 0.0f, const ColCheckType check_type = COLLIDE_COMPLETE, const cSprite_List* objects = NULL)
         {
-            return Collision_Check_Absolute(m_col_rect.m_x + x, m_col_rect.m_y + y, w, h, check_type, objects);
+            Collision_Check_Absolute(col_list, m_col_rect.m_x + x, m_col_rect.m_y + y, w, h, check_type, objects);
         }
         /* Check if the given position is valid
          * Creates a collision rect with the given values
+         * col_list : the found collisions are added to this list
          * check_type : set which collision types are added to the list
          * objects : if set check these object instead of all
-         * The collision data should be deleted if not used anymore
         */
-        cObjectCollisionType* Collision_Check_Absolute(const float x, const float y, const float w = 0.0f, const float h = 0.0f, const ColCheckType check_type = COLLIDE_COMPLETE, cSprite_List* objects = NULL);
+        void Collision_Check_Absolute(cObjectCollisionType& col_list, const float x, const float y, const float w = 0.0f, const float h = 0.0f, const ColCheckType check_type = COLLIDE_COMPLETE, const cSprite_List* objects = NULL);
         /* Check if the given position is valid
+         * col_list : the found collisions are added to this list
          * new_rect : this is the source collision rect
          * check_type : set which collision types are added to the list
          * objects : if set check these object instead of all
-         * The collision data should be deleted if not used anymore
         */
-        cObjectCollisionType* Collision_Check(const GL_rect& new_rect, const ColCheckType check_type = COLLIDE_COMPLETE, cSprite_List* objects = NULL);
+        void Collision_Check(cObjectCollisionType& col_list, const GL_rect& new_rect, const ColCheckType check_type = COLLIDE_COMPLETE, const cSprite_List* objects = NULL);
 
         // Check if the given movement goes out of the level rect and handle possible out of level events
         void Check_And_Handle_Out_Of_Level(const float move_x, const float move_y);
@@ -304,11 +304,23 @@ namespace TSC {
 
     private:
         /* moves in steps and checks in both directions simultaneous
-         * returns the found collisions
-         * sprite_list : objects to check
+         * col_list : the found collisions are added to this list
+         * sprite_list : objects to check, internal collisions are removed from a copy if needed
          * stop_on_internal : if set stops moving if internal collision was found
         */
-        cObjectCollisionType* Col_Move_in_Steps(float move_x, float move_y, float step_size_x, float step_size_y, float final_pos_x, float final_pos_y, cSprite_List sprite_list, bool stop_on_internal = 0);
+        void Col_Move_in_Steps(cObjectCollisionType& col_list, float move_x, float move_y, float step_size_x, float step_size_y, float final_pos_x, float final_pos_y, const cSprite_List& sprite_list, bool stop_on_internal = 0);
+        /* moves in big steps and in pixel steps from the start if something was found
+         * col_list : the found collisions of the pixel steps are added to this list
+         * sprite_list : objects to check
+        */
+        void Col_Move_Stepped(cObjectCollisionType& col_list, float move_x, float move_y, const cSprite_List& sprite_list);
+        /* moves to the first blocking collision time in both directions and continues in the free direction
+         * keeps the same distance to blocking objects as moving in pixel steps
+         * col_list : the found collisions are added to this list
+         * complete_rect : the collision rect of the complete movement
+         * sprite_list : objects to check
+        */
+        void Col_Move_Swept(cObjectCollisionType& col_list, float move_x, float move_y, const GL_rect& complete_rect, const cSprite_List& sprite_list);
     };
 
     /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
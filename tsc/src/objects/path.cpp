@@ -109,23 +109,26 @@ cPath* cPath_State::Get_Path_Object(const std::string& identifier)
         return NULL;
     }
 
+    const cSprite_List& paths = m_sprite_manager->Get_Objects_by_Type(TYPE_PATH);
+    cPath* found = NULL;
+
     // Search for path
-    for (cSprite_List::iterator itr = m_sprite_manager->objects.begin(); itr != m_sprite_manager->objects.end(); ++itr) {
+    for (cSprite_List::const_iterator itr = paths.begin(); itr != paths.end(); ++itr) {
         cSprite* obj = (*itr);
 
-        if (obj->m_type != TYPE_PATH || obj->m_auto_destroy) {
+        if (obj->m_auto_destroy) {
             continue;
         }
 
         cPath* path = static_cast<cPath*>(obj);
 
-        // found
-        if (path->m_identifier.compare(identifier) == 0) {
-            return path;
+        // found : the list is not in array order so use the first one in the array
+        if (path->m_identifier.compare(identifier) == 0 && (!found || path->m_array_num < found->m_array_num)) {
+            found = path;
         }
     }
 
-    return NULL;
+    return found;
 }
 
 void cPath_State::Set_Path_Identifier(const std::string& path)
@@ -484,6 +487,8 @@ void cPath::Init(void)
     m_start_rect.m_w = m_rect.m_w;
     m_start_rect.m_h = m_rect.m_h;
 
+    Update_Collision_Index();
+
     m_rewind = 0;
     m_editor_color = Color(static_cast<Uint8>(100), 150, 200, 128);
     m_editor_selected_segment = 0;
@@ -24,6 +24,7 @@
 #include "../user/savegame/savegame.hpp"
 #include "../core/math/utilities.hpp"
 #include "../core/i18n.hpp"
+#include "../core/sprite_manager.hpp"
 #include "../level/level.hpp"
 #include "../scripting/events/activate_event.hpp"
 #include "../core/global_basic.hpp"
@@ -245,6 +246,7 @@ void cMushroom::Set_Type(SpriteType new_type)
     }
 
     m_type = new_type;
+    m_sprite_manager->Update_Type_Index(this);
     Set_Image_Set("main", 1);
 }
 
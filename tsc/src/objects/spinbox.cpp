@@ -165,18 +165,19 @@ void cSpinBox::Update(void)
                 // set to massive for collision check
                 m_massive_type = MASS_MASSIVE;
                 // collision data
-                cObjectCollisionType* col_list = Collision_Check(&m_col_rect, COLLIDE_ONLY_BLOCKING);
+                cObjectCollisionType col_list;
+                Collision_Check(col_list, &m_col_rect, COLLIDE_ONLY_BLOCKING);
 
                 // check if spinning should continue
                 bool spin_again = 0;
 
                 // colliding with player or enemy
-                if (col_list->Is_Included(TYPE_PLAYER) || col_list->Is_Included(ARRAY_ENEMY)) {
+                if (col_list.Is_Included(TYPE_PLAYER) || col_list.Is_Included(ARRAY_ENEMY)) {
                     spin_again = 1;
                 }
                 // colliding with an active object
-                else if (col_list->Is_Included(ARRAY_ACTIVE)) {
-                    cSprite* col_obj = col_list->Find_First(ARRAY_ACTIVE)->m_obj;
+                else if (col_list.Is_Included(ARRAY_ACTIVE)) {
+                    cSprite* col_obj = col_list.Find_First(ARRAY_ACTIVE)->m_obj;
 
                     // check for items
                     if (col_obj->m_type == TYPE_MUSHROOM_LIVE_1 || col_obj->m_type == TYPE_MUSHROOM_DEFAULT ||
@@ -187,8 +188,6 @@ void cSpinBox::Update(void)
                     }
                 }
 
-                delete col_list;
-
                 // continue spinning
                 if (spin_again) {
                     // spin some time again
@@ -338,6 +338,19 @@ cSprite::cSprite(XmlAttributes& attributes, cSprite_Manager* sprite_manager, con
 
 cSprite::~cSprite(void)
 {
+    // remove from the sprite manager grid
+    if (m_grid_entry.m_grid) {
+        m_grid_entry.m_grid->Remove(this);
+    }
+    // invalidates the collision broad phase if used in it
+    if (cBroad_Phase::m_active) {
+        cBroad_Phase::m_active->Remove(this);
+    }
+    // remove from the cached static geometry
+    if (m_static_layer_entry.m_layer) {
+        m_static_layer_entry.m_layer->Remove(this);
+    }
+
     if (m_delete_image && m_image) {
         delete m_image;
         m_image = NULL;
@@ -401,6 +414,7 @@ void cSprite::Init(void)
     m_active = 1;
     m_spawned = 0;
     m_camera_range = 1000;
+    m_disallow_sleep = 0;
     m_can_be_ground = 0;
     m_disallow_managed_delete = 0;
 
@@ -428,7 +442,18 @@ void cSprite::Init(void)
 
     m_editor_window_name_width = 0.0f;
 
+    m_step_pos_x = 0.0f;
+    m_step_pos_y = 0.0f;
+    m_step_num = 0;
+
     m_uid = -1;
+    m_array_num = -1;
+    m_static = 0;
+    m_awake_stamp = 0;
+    m_indexed_type = TYPE_UNDEFINED;
+    m_indexed_array = ARRAY_UNDEFINED;
+    m_type_list_num = -1;
+    m_array_list_num = -1;
 }
 
 cSprite* cSprite::Copy(void) const
@@ -615,6 +640,9 @@ void cSprite::Set_Image(cGL_Surface* new_image, bool new_start_image /* = 0 */,
         m_rect.m_h = 0.0f;
     }
 
+    // the collision rect size may have changed
+    Update_Collision_Index();
+
     if (!m_start_image || new_start_image) {
         m_start_image = new_image;
 
@@ -635,6 +663,7 @@ void cSprite::Set_Image(cGL_Surface* new_image, bool new_start_image /* = 0 */,
 
     // because col_pos could have changed
     Update_Position_Rect();
+    Update_Static_Draw();
 }
 
 void cSprite::Set_Sprite_Type(SpriteType type)
@@ -676,6 +705,7 @@ void cSprite::Set_Ignore_Camera(bool enable /* = 0 */)
     m_no_camera = enable;
 
     Update_Valid_Draw();
+    Update_Static_Draw();
 }
 
 void cSprite::Set_Pos(float x, float y, bool new_startpos /* = 0 */)
@@ -724,6 +754,7 @@ void cSprite::Set_Active(bool enabled)
 
     Update_Valid_Draw();
     Update_Valid_Update();
+    Update_Static_Draw();
 }
 
 /** Set a Color Combination ( GL_ADD, GL_MODULATE or GL_REPLACE ).
@@ -743,6 +774,8 @@ void cSprite::Set_Color_Combine(const float red, const float green, const float
     m_combine_color[0] = Clamp(red, 0.000001f, 1.0f);
     m_combine_color[1] = Clamp(green, 0.000001f, 1.0f);
     m_combine_color[2] = Clamp(blue, 0.000001f, 1.0f);
+
+    Update_Static_Draw();
 }
 
 void cSprite::Update_Rect_Rotation_Z(void)
@@ -784,6 +817,8 @@ void cSprite::Update_Rect_Rotation_Z(void)
         m_col_rect.m_w = m_col_rect.m_h;
         m_col_rect.m_h = orig_col_w;
     }
+
+    Update_Collision_Index();
 }
 
 void cSprite::Set_Rotation_X(float rot, bool new_start_rot /* = 0 */)
@@ -797,6 +832,8 @@ void cSprite::Set_Rotation_X(float rot, bool new_start_rot /* = 0 */)
     if (m_rotation_affects_rect) {
         Update_Rect_Rotation_X();
     }
+
+    Update_Static_Draw();
 }
 
 void cSprite::Set_Rotation_Y(float rot, bool new_start_rot /* = 0 */)
@@ -810,6 +847,8 @@ void cSprite::Set_Rotation_Y(float rot, bool new_start_rot /* = 0 */)
     if (m_rotation_affects_rect) {
         Update_Rect_Rotation_Y();
     }
+
+    Update_Static_Draw();
 }
 
 void cSprite::Set_Rotation_Z(float rot, bool new_start_rot /* = 0 */)
@@ -823,6 +862,8 @@ void cSprite::Set_Rotation_Z(float rot, bool new_start_rot /* = 0 */)
     if (m_rotation_affects_rect) {
         Update_Rect_Rotation_Z();
     }
+
+    Update_Static_Draw();
 }
 void cSprite::Set_Scale_X(const float scale, const bool new_startscale /* = 0 */)
 {
@@ -848,6 +889,10 @@ void cSprite::Set_Scale_X(const float scale, const bool new_startscale /* = 0 */
     if (new_startscale) {
         m_start_scale_x = m_scale_x;
     }
+
+    Update_Collision_Index();
+
+    Update_Static_Draw();
 }
 
 void cSprite::Set_Scale_Y(const float scale, const bool new_startscale /* = 0 */)
@@ -874,6 +919,10 @@ void cSprite::Set_Scale_Y(const float scale, const bool new_startscale /* = 0 */
     if (new_startscale) {
         m_start_scale_y = m_scale_y;
     }
+
+    Update_Collision_Index();
+
+    Update_Static_Draw();
 }
 void cSprite::Set_On_Top(const cSprite* sprite, bool optimize_hor_pos /* = 1 */)
 {
@@ -907,6 +956,9 @@ void cSprite::Move(float move_x, float move_y, const bool real /* = 0 */)
 
 void cSprite::Update_Position_Rect(void)
 {
+    const float old_col_x = m_col_rect.m_x;
+    const float old_col_y = m_col_rect.m_y;
+
     // if not editor mode
     if (!editor_enabled) {
         m_rect.m_x = m_pos_x;
@@ -929,14 +981,66 @@ void cSprite::Update_Position_Rect(void)
         m_col_rect.m_y = m_pos_y + m_col_pos.m_y;
     }
 
+    // moved while playing
+    if (m_static && !editor_enabled && (!Is_Float_Equal(old_col_x, m_col_rect.m_x) || !Is_Float_Equal(old_col_y, m_col_rect.m_y))) {
+        m_sprite_manager->Set_Dynamic(this);
+    }
+
+    Update_Collision_Index();
     Update_Valid_Draw();
 }
 
+void cSprite::Update_Collision_Index(void)
+{
+    // update the sprite manager grid
+    if (m_grid_entry.m_grid) {
+        m_grid_entry.m_grid->Update(this);
+    }
+    // check if still inside the collision broad phase rect
+    if (cBroad_Phase::m_active) {
+        cBroad_Phase::m_active->Update(this);
+    }
+}
+
+void cSprite::Save_Step_Pos(void)
+{
+    m_step_pos_x = m_pos_x;
+    m_step_pos_y = m_pos_y;
+    m_step_num = pFramerate->m_fixed_step;
+}
+
+void cSprite::Get_Step_Offset(float& x, float& y) const
+{
+    x = 0.0f;
+    y = 0.0f;
+
+    // interpolate between the position before and after the last fixed step
+    if (!pFramerate->m_fixed_timestep || m_step_num != pFramerate->m_fixed_step) {
+        return;
+    }
+
+    const float step_x = m_pos_x - m_step_pos_x;
+    const float step_y = m_pos_y - m_step_pos_y;
+
+    // not if moved too far as it was probably placed somewhere else
+    if (fabs(step_x) < fixed_step_max_interpolation && fabs(step_y) < fixed_step_max_interpolation) {
+        x = -step_x * (1.0f - pFramerate->m_interpolation);
+        y = -step_y * (1.0f - pFramerate->m_interpolation);
+    }
+}
+
 void cSprite::Update_Valid_Draw(void)
 {
     m_valid_draw = Is_Draw_Valid();
 }
 
+void cSprite::Update_Static_Draw(void)
+{
+    if (m_static && m_sprite_manager) {
+        m_sprite_manager->m_static_layer.Invalidate(this);
+    }
+}
+
 void cSprite::Update_Valid_Update(void)
 {
     m_valid_update = Is_Update_Valid();
@@ -1051,6 +1155,7 @@ void cSprite::Draw_Image_Normal(cSurface_Request* request /* = NULL */) const
 {
     // texture id
     request->m_texture_id = m_image->m_image;
+    request->m_tex_coords = m_image->m_tex_coords;
 
     // size
     request->m_w = m_image->m_start_w;
@@ -1119,6 +1224,13 @@ void cSprite::Draw_Image_Normal(cSurface_Request* request /* = NULL */) const
     // position z
     request->m_pos_z = m_pos_z;
 
+    // interpolated position
+    float step_x;
+    float step_y;
+    Get_Step_Offset(step_x, step_y);
+    request->m_pos_x += step_x;
+    request->m_pos_y += step_y;
+
     // no camera setting
     request->m_no_camera = m_no_camera;
 
@@ -1143,6 +1255,7 @@ void cSprite::Draw_Image_Editor(cSurface_Request* request /* = NULL */) const
 {
     // texture id
     request->m_texture_id = m_start_image->m_image;
+    request->m_tex_coords = m_start_image->m_tex_coords;
 
     // size
     request->m_w = m_start_image->m_start_w;
@@ -1273,8 +1386,12 @@ void cSprite::Set_Massive_Type(MassiveType type)
         m_can_be_ground = false;
     }
 
+    // the array may have changed
+    m_sprite_manager->Update_Type_Index(this);
     // make it the latest sprite
     m_sprite_manager->Move_To_Back(this);
+    // z position changed
+    Update_Static_Draw();
 }
 
 bool cSprite::Is_On_Top(const cSprite* obj) const
@@ -22,6 +22,9 @@
 #include "../video/video.hpp"
 #include "../video/img_set.hpp"
 #include "../core/collision.hpp"
+#include "../core/sprite_grid.hpp"
+#include "../core/broad_phase.hpp"
+#include "../core/static_layer.hpp"
 #include "../scripting/scriptable_object.hpp"
 #include "../scripting/scripting.hpp"
 #include "../scripting/objects/sprites/mrb_sprite.hpp"
@@ -190,11 +193,13 @@ namespace TSC {
         inline void Set_Shadow_Pos(const float pos)
         {
             m_shadow_pos = pos;
+            Update_Static_Draw();
         };
         // Set the shadow color
         inline void Set_Shadow_Color(const Color& shadow)
         {
             m_shadow_color = shadow;
+            Update_Static_Draw();
         };
         // Set image color
         inline void Set_Color(const Uint8 red, const Uint8 green, const Uint8 blue, const Uint8 alpha = 255)
@@ -203,10 +208,12 @@ namespace TSC {
             m_color.green = green;
             m_color.blue = blue;
             m_color.alpha = alpha;
+            Update_Static_Draw();
         };
         inline void Set_Color(const Color& col)
         {
             m_color = col;
+            Update_Static_Draw();
         };
 
         /// Set a Color Combination ( GL_ADD, GL_MODULATE or GL_REPLACE )
@@ -356,14 +363,26 @@ namespace TSC {
 
         // Update the position rect values
         void Update_Position_Rect(void);
+        // Update the collision indices after the collision rect changed
+        void Update_Collision_Index(void);
         // default update, derived updates should not call this again if they also call Update_Animation()
         virtual void Update(void) { Update_Animation(); };
         /* late update
          * use if it is needed that other objects are already updated
         */
         virtual void Update_Late(void) {};
+        // Save the position before a fixed step
+        virtual void Save_Step_Pos(void);
+        /* Get the offset from the current to the interpolated drawing position
+         * zero if not moved in the last fixed step
+        */
+        void Get_Step_Offset(float& x, float& y) const;
         // update drawing validation
         virtual void Update_Valid_Draw(void);
+        /* Rebuild the cached static geometry of this sprite
+         * call if anything used for drawing changes
+        */
+        void Update_Static_Draw(void);
         // update updating validation
         virtual void Update_Valid_Update(void);
 
@@ -474,6 +493,11 @@ namespace TSC {
          * it's only used if not 0
         */
         float m_editor_pos_z;
+        /// position before the last fixed step, used to interpolate the drawing position
+        float m_step_pos_x;
+        float m_step_pos_y;
+        /// fixed step the step position was saved in or 0
+        unsigned int m_step_num;
 
         /// if set rotation not only affects the image but also the rectangle
         bool m_rotation_affects_rect;
@@ -535,6 +559,8 @@ namespace TSC {
         bool m_spawned;
         /// maximum distance to the camera to get updated
         unsigned int m_camera_range;
+        /// updated even if outside of the sprite manager active region
+        bool m_disallow_sleep;
         /// can be used as ground object
         bool m_can_be_ground;
 
@@ -566,6 +592,25 @@ namespace TSC {
 
         /// ID to uniquely identify this sprite (UIDS[idhere] uses this)
         int m_uid;
+        /// position in the sprite manager objects array or -1
+        int m_array_num;
+        /// set by the sprite manager if this never moves and is not updated
+        bool m_static;
+        /// last sprite manager Update_Items call which updated this sprite
+        unsigned int m_awake_stamp;
+        /// type and array the sprite manager lists this under
+        SpriteType m_indexed_type;
+        ArrayType m_indexed_array;
+        /// position in the sprite manager type and array lists or -1
+        int m_type_list_num;
+        int m_array_list_num;
+
+        /// sprite manager grid data
+        cSprite_Grid_Entry m_grid_entry;
+        /// collision broad phase data
+        cBroad_Phase_Entry m_broad_phase_entry;
+        /// sprite manager static layer data
+        cStatic_Layer_Entry m_static_layer_entry;
 
         static const float m_pos_z_passive_start; ///< Start Z position for passive elements
         static const float m_pos_z_massive_start; ///< Start Z position for massive elements
@@ -23,6 +23,7 @@
 #include "../core/i18n.hpp"
 #include "../core/filesystem/filesystem.hpp"
 #include "../core/filesystem/resource_manager.hpp"
+#include "../core/filesystem/package_manager.hpp"
 #include "overworld_loader.hpp"
 #include "../core/editor/editor_items_loader.hpp"
 
@@ -232,6 +233,9 @@ void cEditor_World::Function_Reload(void)
         return;
     }
 
+    // resources may have been added or changed
+    pPackage_Manager->Rescan_Resources();
+
     cOverworld* p_old_world = m_overworld;
     m_overworld = cOverworld::Load_From_Directory(p_old_world->m_description->Get_Path());
     delete p_old_world;
@@ -66,21 +66,18 @@ static mrb_value _Index(mrb_state* p_state, mrb_value cache, mrb_value ruid)
 
     // Otherwise, allocate a new MRuby object for it and store
     // that new object in the cache.
-    cSprite_List objs = pActive_Level->m_sprite_manager->objects; // Shorthand
     mrb_int uid = mrb_fixnum(ruid);
-    for (cSprite_List::const_iterator iter = objs.begin(); iter != objs.end(); iter++) {
-        if ((*iter)->m_uid == uid) {
-            // Ask the sprite to create the correct type of MRuby object
-            // so we don’t have to maintain a static C++/MRuby type mapping table
-            mrb_value obj = (*iter)->Create_MRuby_Object(p_state);
-            // Store it in the cache
-            mrb_hash_set(p_state, cache, ruid, obj);
-
-            return obj;
-        }
-    }
+    cSprite* p_sprite = pActive_Level->m_sprite_manager->Get_by_UID(uid);
+    if (!p_sprite)
+        return mrb_nil_value();
+
+    // Ask the sprite to create the correct type of MRuby object
+    // so we don’t have to maintain a static C++/MRuby type mapping table
+    mrb_value obj = p_sprite->Create_MRuby_Object(p_state);
+    // Store it in the cache
+    mrb_hash_set(p_state, cache, ruid, obj);
 
-    return mrb_nil_value();
+    return obj;
 }
 
 /**
@@ -92,9 +89,9 @@ static mrb_value _Index(mrb_state* p_state, mrb_value cache, mrb_value ruid)
  *
  * Retrieve an MRuby object for the sprite with the unique identifier
  * `uid`. The first time you call this method with a given UID, it
- * will cycle through _all_ sprite objects in the level, so it will
- * take relatively long. The sprite object is then cached internally,
- * causing later lookups to be fast.
+ * has to create the MRuby object for the sprite, so it will take a
+ * bit longer. The sprite object is then cached internally, causing
+ * later lookups to be fast.
  *
  * #### Parameters
  * uid
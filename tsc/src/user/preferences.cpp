@@ -43,6 +43,9 @@ const bool cPreferences::m_always_run_default = 0;
 const std::string cPreferences::m_menu_level_default = "menu_brown_1";
 const float cPreferences::m_camera_hor_speed_default = 0.3f;
 const float cPreferences::m_camera_ver_speed_default = 0.2f;
+const unsigned int cPreferences::m_active_region_default = 0;
+const bool cPreferences::m_fixed_timestep_default = 0;
+const bool cPreferences::m_swept_collision_default = 0;
 // Video
 #ifdef _DEBUG
 const bool cPreferences::m_video_fullscreen_default = 0;
@@ -57,6 +60,7 @@ const Uint8 cPreferences::m_video_screen_bpp_default = 32;
 */
 const bool cPreferences::m_video_vsync_default = 0;
 const Uint16 cPreferences::m_video_fps_limit_default = 240;
+const bool cPreferences::m_video_render_thread_default = 0;
 // default geometry detail is medium
 const float cPreferences::m_geometry_quality_default = 0.5f;
 // default texture detail is high
@@ -155,6 +159,9 @@ void cPreferences::Save(void)
     Add_Property(p_root, "game_menu_level", m_menu_level);
     Add_Property(p_root, "game_camera_hor_speed", m_camera_hor_speed);
     Add_Property(p_root, "game_camera_ver_speed", m_camera_ver_speed);
+    Add_Property(p_root, "game_active_region", m_active_region);
+    Add_Property(p_root, "game_fixed_timestep", m_fixed_timestep);
+    Add_Property(p_root, "game_swept_collision", m_swept_collision);
     // Video
     Add_Property(p_root, "video_fullscreen", m_video_fullscreen);
     Add_Property(p_root, "video_screen_w", m_video_screen_w);
@@ -162,6 +169,7 @@ void cPreferences::Save(void)
     Add_Property(p_root, "video_screen_bpp", static_cast<int>(m_video_screen_bpp));
     Add_Property(p_root, "video_vsync", m_video_vsync);
     Add_Property(p_root, "video_fps_limit", m_video_fps_limit);
+    Add_Property(p_root, "video_render_thread", m_video_render_thread);
     Add_Property(p_root, "video_geometry_quality", pVideo->m_geometry_quality);
     Add_Property(p_root, "video_texture_quality", pVideo->m_texture_quality);
     // Audio
@@ -238,6 +246,9 @@ void cPreferences::Reset_Game(void)
     m_menu_level = m_menu_level_default;
     m_camera_hor_speed = m_camera_hor_speed_default;
     m_camera_ver_speed = m_camera_ver_speed_default;
+    m_active_region = m_active_region_default;
+    m_fixed_timestep = m_fixed_timestep_default;
+    m_swept_collision = m_swept_collision_default;
 }
 
 void cPreferences::Reset_Video(void)
@@ -248,6 +259,7 @@ void cPreferences::Reset_Video(void)
     m_video_screen_bpp = m_video_screen_bpp_default;
     m_video_vsync = m_video_vsync_default;
     m_video_fps_limit = m_video_fps_limit_default;
+    m_video_render_thread = m_video_render_thread_default;
     m_video_fullscreen = m_video_fullscreen_default;
     pVideo->m_geometry_quality = m_geometry_quality_default;
     pVideo->m_texture_quality = m_texture_quality_default;
@@ -72,6 +72,13 @@ namespace TSC {
         // smart camera speed
         float m_camera_hor_speed;
         float m_camera_ver_speed;
+        // level sprites farther away from the camera are not updated
+        // 0 updates all sprites
+        unsigned int m_active_region;
+        // update the game in fixed steps and interpolate the drawing between them
+        bool m_fixed_timestep;
+        // solve the level sprite movement with swept collision rects instead of steps
+        bool m_swept_collision;
 
         // Audio
         bool m_audio_music;
@@ -85,6 +92,8 @@ namespace TSC {
         Uint8 m_video_screen_bpp;
         bool m_video_vsync;
         Uint16 m_video_fps_limit;
+        // render the game in a separate thread while the next frame is updated
+        bool m_video_render_thread;
 
         // Keyboard
         // key definitions
@@ -158,6 +167,9 @@ namespace TSC {
         static const std::string m_menu_level_default;
         static const float m_camera_hor_speed_default;
         static const float m_camera_ver_speed_default;
+        static const unsigned int m_active_region_default;
+        static const bool m_fixed_timestep_default;
+        static const bool m_swept_collision_default;
         // Audio
         static const bool m_audio_music_default;
         static const bool m_audio_sound_default;
@@ -171,6 +183,7 @@ namespace TSC {
         static const Uint8 m_video_screen_bpp_default;
         static const bool m_video_vsync_default;
         static const Uint16 m_video_fps_limit_default;
+        static const bool m_video_render_thread_default;
         static const float m_geometry_quality_default;
         static const float m_texture_quality_default;
         // Keyboard
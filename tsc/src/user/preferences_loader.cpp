@@ -130,6 +130,15 @@ void cPreferencesLoader::handle_property(const std::string& name, const std::str
         mp_preferences->m_camera_hor_speed = string_to_float(value);
     else if (name == "game_camera_ver_speed" || name == "camera_ver_speed")
         mp_preferences->m_camera_ver_speed = string_to_float(value);
+    else if (name == "game_active_region") {
+        val = string_to_int(value);
+        if (val >= 0)
+            mp_preferences->m_active_region = val;
+    }
+    else if (name == "game_fixed_timestep")
+        mp_preferences->m_fixed_timestep = string_to_bool(value);
+    else if (name == "game_swept_collision")
+        mp_preferences->m_swept_collision = string_to_bool(value);
     //////////////////// Video ////////////////////
     else if (name == "video_screen_h") {
         val = string_to_int(value);
@@ -162,6 +171,8 @@ void cPreferencesLoader::handle_property(const std::string& name, const std::str
         mp_preferences->m_video_vsync = string_to_bool(value);
     else if (name == "video_fps_limit")
         mp_preferences->m_video_fps_limit = string_to_int(value);
+    else if (name == "video_render_thread")
+        mp_preferences->m_video_render_thread = string_to_bool(value);
     else if (name == "video_fullscreen")
         mp_preferences->m_video_fullscreen = string_to_bool(value);
     else if (name == "video_geometry_detail" || name == "video_geometry_quality")
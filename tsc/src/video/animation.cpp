@@ -324,13 +324,22 @@ void cAnimation_Fireball::Draw(cSurface_Request* request /* = NULL */)
         return;
     }
 
+    // interpolated position
+    float step_x;
+    float step_y;
+    Get_Step_Offset(step_x, step_y);
+
     // draw objects
     for (FireAnimList::iterator itr = m_objects.begin(); itr != m_objects.end(); ++itr) {
         cAnimation_Fireball_Item* obj = (*itr);
 
+        float obj_step_x;
+        float obj_step_y;
+        obj->Get_Step_Offset(obj_step_x, obj_step_y);
+
         // create request
         cSurface_Request* request = new cSurface_Request();
-        obj->m_image->Blit(obj->m_pos_x - (pActive_Camera->m_x - m_pos_x), obj->m_pos_y - (pActive_Camera->m_y - m_pos_y), obj->m_pos_z, request);
+        obj->m_image->Blit(obj->m_pos_x + obj_step_x - (pActive_Camera->m_x - m_pos_x - step_x), obj->m_pos_y + obj_step_y - (pActive_Camera->m_y - m_pos_y - step_y), obj->m_pos_z, request);
 
         // scale
         request->m_scale_x = obj->m_scale_x;
@@ -344,6 +353,15 @@ void cAnimation_Fireball::Draw(cSurface_Request* request /* = NULL */)
     }
 }
 
+void cAnimation_Fireball::Save_Step_Pos(void)
+{
+    cAnimation::Save_Step_Pos();
+
+    for (FireAnimList::iterator itr = m_objects.begin(); itr != m_objects.end(); ++itr) {
+        (*itr)->Save_Step_Pos();
+    }
+}
+
 /* *** *** *** *** *** *** *** cParticle *** *** *** *** *** *** *** *** *** *** */
 
 cParticle::cParticle(cParticle_Emitter* parent)
@@ -422,8 +440,12 @@ void cParticle::Draw(cSurface_Request* request /* = NULL */)
 
     // based on emitter position
     if (m_parent->m_particle_based_on_emitter_pos > 0.0f) {
-        request->m_pos_x += (m_parent->m_pos_x * m_parent->m_particle_based_on_emitter_pos);
-        request->m_pos_y += (m_parent->m_pos_y * m_parent->m_particle_based_on_emitter_pos);
+        float step_x;
+        float step_y;
+        m_parent->Get_Step_Offset(step_x, step_y);
+
+        request->m_pos_x += ((m_parent->m_pos_x + step_x) * m_parent->m_particle_based_on_emitter_pos);
+        request->m_pos_y += ((m_parent->m_pos_y + step_y) * m_parent->m_particle_based_on_emitter_pos);
     }
 
     // blending
@@ -1007,6 +1029,15 @@ void cParticle_Emitter::Draw(cSurface_Request* request /* = NULL */)
     }
 }
 
+void cParticle_Emitter::Save_Step_Pos(void)
+{
+    cAnimation::Save_Step_Pos();
+
+    for (ParticleList::iterator itr = m_objects.begin(); itr != m_objects.end(); ++itr) {
+        (*itr)->Save_Step_Pos();
+    }
+}
+
 void cParticle_Emitter::Keep_Particles_In_Rect(const GL_rect& clip_rect, ParticleClipMode mode /* = PCM_MOVE */)
 {
     // temporary obj rect
@@ -2134,6 +2165,13 @@ void cAnimation_Manager::Draw(void)
     }
 }
 
+void cAnimation_Manager::Save_Step_Pos(void)
+{
+    for (cAnimation_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+        (*itr)->Save_Step_Pos();
+    }
+}
+
 void cAnimation_Manager::Add(cAnimation* animation)
 {
     if (!animation) {
@@ -111,6 +111,8 @@ namespace TSC {
         virtual void Update(void);
         // draw
         virtual void Draw(cSurface_Request* request = NULL);
+        // Save the position of this and the items before a fixed step
+        virtual void Save_Step_Pos(void);
 
         typedef vector<cAnimation_Fireball_Item*> FireAnimList;
         FireAnimList m_objects;
@@ -198,6 +200,8 @@ namespace TSC {
         void Update_Position(void);
         // Draw everything
         virtual void Draw(cSurface_Request* request = NULL);
+        // Save the position of the emitter and the particles before a fixed step
+        virtual void Save_Step_Pos(void);
 
         // keep particles in the given rectangle
         void Keep_Particles_In_Rect(const GL_rect& clip_rect, ParticleClipMode mode = PCM_MOVE);
@@ -392,6 +396,8 @@ namespace TSC {
         void Update(void);
         // Draw the objects
         void Draw(void);
+        // Save the positions of the objects before a fixed step
+        void Save_Step_Pos(void);
 
         typedef vector<cAnimation*> cAnimation_List;
     };
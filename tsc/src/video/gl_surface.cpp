@@ -33,6 +33,8 @@ namespace TSC {
 cGL_Surface::cGL_Surface(void)
 {
     m_image = 0;
+    m_tex_coords = GL_rect(0.0f, 0.0f, 1.0f, 1.0f);
+    m_atlas = 0;
 
     m_int_x = 0;
     m_int_y = 0;
@@ -57,6 +59,7 @@ cGL_Surface::cGL_Surface(void)
     m_auto_del_img = 1;
     m_managed = 0;
     m_obsolete = 0;
+    m_loading = 0;
 
     // default massive type is passive
     m_massive_type = MASS_PASSIVE;
@@ -68,9 +71,22 @@ cGL_Surface::cGL_Surface(void)
 
 cGL_Surface::~cGL_Surface(void)
 {
+    if (m_loading && pVideo) {
+        pVideo->Cancel_Async_Surface(this);
+    }
+
+    // the render thread has the OpenGL context and the texture is deleted later
+    const bool render_pending = pVideo && pVideo->Is_Render_Pending();
+
     // don't delete a managed OpenGL image if still in use by another managed cGL_Surface
-    if (m_auto_del_img && glIsTexture(m_image) && (!m_managed || !Is_Texture_Use_Multiple())) {
-        glDeleteTextures(1, &m_image);
+    // atlas pages are deleted by the image manager
+    if (m_auto_del_img && !m_atlas && m_image && (render_pending || glIsTexture(m_image)) && (!m_managed || !Is_Texture_Use_Multiple())) {
+        if (render_pending) {
+            pVideo->Delete_Texture(m_image);
+        }
+        else {
+            glDeleteTextures(1, &m_image);
+        }
     }
 
     if (destruction_function) {
@@ -85,6 +101,8 @@ cGL_Surface* cGL_Surface::Copy(void) const
 
     // data
     new_surface->m_image = m_image;
+    new_surface->m_tex_coords = m_tex_coords;
+    new_surface->m_atlas = m_atlas;
     new_surface->m_int_x = m_int_x;
     new_surface->m_int_y = m_int_y;
     new_surface->m_start_w = m_start_w;
@@ -111,6 +129,37 @@ cGL_Surface* cGL_Surface::Copy(void) const
     return new_surface;
 }
 
+void cGL_Surface::Take_Texture(cGL_Surface* image)
+{
+    // data
+    m_image = image->m_image;
+    m_tex_coords = image->m_tex_coords;
+    m_atlas = image->m_atlas;
+    m_int_x = image->m_int_x;
+    m_int_y = image->m_int_y;
+    m_start_w = image->m_start_w;
+    m_start_h = image->m_start_h;
+    m_w = image->m_w;
+    m_h = image->m_h;
+    m_tex_w = image->m_tex_w;
+    m_tex_h = image->m_tex_h;
+    m_base_rot_x = image->m_base_rot_x;
+    m_base_rot_y = image->m_base_rot_y;
+    m_base_rot_z = image->m_base_rot_z;
+    m_col_pos = image->m_col_pos;
+    m_col_w = image->m_col_w;
+    m_col_h = image->m_col_h;
+
+    // settings
+    m_obsolete = image->m_obsolete;
+    m_editor_tags = image->m_editor_tags;
+    m_name = image->m_name;
+    m_massive_type = image->m_massive_type;
+    Set_Ground_Type(image->m_ground_type);
+
+    image->m_auto_del_img = 0;
+}
+
 void cGL_Surface::Blit(float x, float y, float z, cSurface_Request* request /* = NULL */) const
 {
     bool create_request = 0;
@@ -138,6 +187,7 @@ void cGL_Surface::Blit_Data(cSurface_Request* request) const
 {
     // texture id
     request->m_texture_id = m_image;
+    request->m_tex_coords = m_tex_coords;
 
     // position
     request->m_pos_x += m_int_x;
@@ -163,10 +213,30 @@ void cGL_Surface::Save(const std::string& filename)
     // bind the texture
     glBindTexture(GL_TEXTURE_2D, m_image);
 
+    GLint width = m_tex_w;
+    GLint height = m_tex_h;
+
+    // the whole atlas page is read
+    if (m_atlas) {
+        glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &width);
+        glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &height);
+    }
+
     // create image data
-    GLubyte* data = new GLubyte[m_tex_w * m_tex_h * 4];
+    GLubyte* data = new GLubyte[width * height * 4];
     // read texture
     glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, static_cast<GLvoid*>(data));
+
+    // move the image to the start of the data
+    if (m_atlas) {
+        const unsigned int start_x = static_cast<unsigned int>(m_tex_coords.m_x * width + 0.5f);
+        const unsigned int start_y = static_cast<unsigned int>(m_tex_coords.m_y * height + 0.5f);
+
+        for (unsigned int y = 0; y < m_tex_h; y++) {
+            memmove(data + (y * m_tex_w * 4), data + (((start_y + y) * width + start_x) * 4), m_tex_w * 4);
+        }
+    }
+
     // save
     pVideo->Save_Surface(filename, data, m_tex_w, m_tex_h);
     // clear data
@@ -200,7 +270,8 @@ cSaved_Texture* cGL_Surface::Get_Software_Texture(bool only_filename /* = 0 */)
     cSaved_Texture* soft_tex = new cSaved_Texture();
 
     // hardware texture to software texture
-    if (!only_filename) {
+    // atlas images are always loaded again from the file
+    if (!only_filename && !m_atlas) {
         // bind the texture
         glBindTexture(GL_TEXTURE_2D, m_image);
 
@@ -269,6 +340,8 @@ void cGL_Surface::Load_Software_Texture(cSaved_Texture* soft_tex)
         pVideo->Create_GL_Texture(soft_tex->m_width, soft_tex->m_height, soft_tex->m_pixels, mipmaps);
 
         m_image = tex_id;
+        m_tex_coords = GL_rect(0.0f, 0.0f, 1.0f, 1.0f);
+        m_atlas = 0;
     }
     // load from file
     else {
@@ -281,6 +354,8 @@ void cGL_Surface::Load_Software_Texture(cSaved_Texture* soft_tex)
 
         // get image
         m_image = surface_copy->m_image;
+        m_tex_coords = surface_copy->m_tex_coords;
+        m_atlas = surface_copy->m_atlas;
         m_tex_w = surface_copy->m_tex_w;
         m_tex_h = surface_copy->m_tex_h;
         // keep hardware texture
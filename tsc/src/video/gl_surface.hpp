@@ -19,6 +19,7 @@
 
 #include "../core/global_basic.hpp"
 #include "../core/math/point.hpp"
+#include "../core/math/rect.hpp"
 
 namespace TSC {
 
@@ -38,6 +39,10 @@ namespace TSC {
 
         // Copy cGL_Surface and return it
         cGL_Surface* Copy(void) const;
+        /* Take the texture and the image settings of the given surface
+         * the given surface no longer deletes the texture
+        */
+        void Take_Texture(cGL_Surface* image);
 
         // Save the texture to a file
         void Save(const std::string& filename);
@@ -63,6 +68,10 @@ namespace TSC {
 
         // GL texture number
         GLuint m_image;
+        // texture coordinates of the image
+        GL_rect m_tex_coords;
+        // if set the texture is an atlas page shared with other images
+        bool m_atlas;
         // internal drawing offset
         float m_int_x;
         float m_int_y;
@@ -92,6 +101,8 @@ namespace TSC {
         bool m_managed;
         // if the image is tagged as obsolete
         bool m_obsolete;
+        // if the texture is still loaded in the background
+        bool m_loading;
 
         // editor tags
         std::string m_editor_tags;
@@ -17,6 +17,7 @@
 #include "../video/img_manager.hpp"
 #include "../video/renderer.hpp"
 #include "../core/i18n.hpp"
+#include "../core/property_helper.hpp"
 #include "../core/global_basic.hpp"
 
 using namespace std;
@@ -55,6 +56,8 @@ cImage_Manager::cImage_Manager(void)
     : cObject_Manager<cGL_Surface>()
 {
     m_high_texture_id = 0;
+    m_path_hits = 0;
+    m_path_misses = 0;
 }
 
 cImage_Manager::~cImage_Manager(void)
@@ -73,37 +76,58 @@ void cImage_Manager::Add(cGL_Surface* obj)
 
     // Add
     cObject_Manager<cGL_Surface>::Add(obj);
+    const std::string key = Get_Path_Key(obj->m_path);
+    // an already added path keeps its surface
+    m_paths[key].push_back(obj);
+    m_path_keys[obj] = key;
 }
 
-cGL_Surface* cImage_Manager::Get_Pointer(const fs::path& path) const
+bool cImage_Manager::Delete(size_t array_num, bool delete_data /* = 1 */)
 {
-    for (GL_Surface_List::const_iterator itr = objects.begin(); itr != objects.end(); ++itr) {
-        cGL_Surface* obj = (*itr);
+    if (array_num >= objects.size()) {
+        return 0;
+    }
 
-        // return first match
-        if (obj->m_path.compare(path) == 0) {
-            return obj;
-        }
+    Remove_Path(objects[array_num]);
+
+    return cObject_Manager<cGL_Surface>::Delete(array_num, delete_data);
+}
+
+bool cImage_Manager::Delete(cGL_Surface* obj, bool delete_data /* = 1 */)
+{
+    if (!obj) {
+        return 0;
     }
 
+    Remove_Path(obj);
+
+    return cObject_Manager<cGL_Surface>::Delete(obj, delete_data);
+}
+
+cGL_Surface* cImage_Manager::Get_Pointer(const fs::path& path) const
+{
+    GL_Surface_Path_Map::const_iterator itr = m_paths.find(Get_Path_Key(path));
+
     // not found
-    return NULL;
+    if (itr == m_paths.end()) {
+        m_path_misses++;
+        return NULL;
+    }
+
+    m_path_hits++;
+    return itr->second.front();
 }
 
 cGL_Surface* cImage_Manager::Copy(const fs::path& path)
 {
-    for (GL_Surface_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
-        // get object
-        cGL_Surface* obj = (*itr);
+    cGL_Surface* obj = Get_Pointer(path);
 
-        // first match
-        if (obj->m_path.compare(path) == 0) {
-            return obj->Copy();
-        }
+    // not found
+    if (!obj) {
+        return NULL;
     }
 
-    // not found
-    return NULL;
+    return obj->Copy();
 }
 
 void cImage_Manager::Grab_Textures(bool from_file /* = 0 */, bool draw_gui /* = 0 */)
@@ -127,6 +151,13 @@ void cImage_Manager::Grab_Textures(bool from_file /* = 0 */, bool draw_gui /* =
         // get surface
         cGL_Surface* obj = (*itr);
 
+        // atlas images are loaded again from file and the pages are deleted afterwards
+        if (obj->m_atlas) {
+            m_saved_textures.push_back(obj->Get_Software_Texture(1));
+            loaded_files++;
+            continue;
+        }
+
         // skip surfaces with an already deleted texture
         if (!glIsTexture(obj->m_image)) {
             continue;
@@ -150,6 +181,8 @@ void cImage_Manager::Grab_Textures(bool from_file /* = 0 */, bool draw_gui /* =
             Loading_Screen_Draw();
         }
     }
+
+    m_texture_atlas.Clear();
 }
 
 void cImage_Manager::Restore_Textures(bool draw_gui /* = 0 */)
@@ -199,10 +232,12 @@ void cImage_Manager::Delete_Image_Textures(void)
         // get object
         cGL_Surface* obj = (*itr);
 
-        if (obj->m_auto_del_img && glIsTexture(obj->m_image)) {
+        if (obj->m_auto_del_img && !obj->m_atlas && obj->m_image && glIsTexture(obj->m_image)) {
             glDeleteTextures(1, &obj->m_image);
         }
     }
+
+    m_texture_atlas.Clear();
 }
 
 void cImage_Manager::Delete_Hardware_Textures(void)
@@ -216,6 +251,8 @@ void cImage_Manager::Delete_Hardware_Textures(void)
     }
 
     m_high_texture_id = 0;
+    // pages are already deleted
+    m_texture_atlas.Clear(0);
 }
 
 void cImage_Manager::Delete_All(void)
@@ -223,6 +260,49 @@ void cImage_Manager::Delete_All(void)
     // stops cGL_Surface destructor from checking if GL texture id still in use
     Delete_Image_Textures();
     cObject_Manager<cGL_Surface>::Delete_All();
+    m_paths.clear();
+    m_path_keys.clear();
+}
+
+std::string cImage_Manager::Get_Path_Key(const fs::path& path)
+{
+    // the same as comparing the paths element by element
+    std::string key;
+
+    for (fs::path::const_iterator itr = path.begin(); itr != path.end(); ++itr) {
+        if (itr != path.begin()) {
+            key += '/';
+        }
+
+        key += path_to_utf8(*itr);
+    }
+
+    return key;
+}
+
+void cImage_Manager::Remove_Path(cGL_Surface* obj)
+{
+    // the path may have changed since it was added
+    GL_Surface_Key_Map::iterator key_itr = m_path_keys.find(obj);
+
+    if (key_itr == m_path_keys.end()) {
+        return;
+    }
+
+    GL_Surface_Path_Map::iterator itr = m_paths.find(key_itr->second);
+    m_path_keys.erase(key_itr);
+
+    if (itr == m_paths.end()) {
+        return;
+    }
+
+    // the next surface with the same path is used
+    GL_Surface_List& surfaces = itr->second;
+    surfaces.erase(std::remove(surfaces.begin(), surfaces.end(), obj), surfaces.end());
+
+    if (surfaces.empty()) {
+        m_paths.erase(itr);
+    }
 }
 
 /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
@@ -21,6 +21,7 @@
 #include "../video/video.hpp"
 #include "../core/obj_manager.hpp"
 #include "../video/gl_surface.hpp"
+#include "../video/texture_atlas.hpp"
 
 namespace TSC {
 
@@ -53,6 +54,9 @@ namespace TSC {
 
     typedef vector<cSaved_Texture*> Saved_Texture_List;
     typedef vector<cGL_Surface*> GL_Surface_List;
+    // surfaces with the same path in the order they were added
+    typedef boost::unordered_map<std::string, GL_Surface_List> GL_Surface_Path_Map;
+    typedef boost::unordered_map<const cGL_Surface*, std::string> GL_Surface_Key_Map;
 
     /* *** *** *** *** *** *** cImage_Manager *** *** *** *** *** *** *** *** *** *** *** */
 
@@ -69,7 +73,14 @@ namespace TSC {
         // Add a surface
         virtual void Add(cGL_Surface* obj);
 
-        // Return the surface by path
+        // Delete the surface from given array number
+        virtual bool Delete(size_t array_num, bool delete_data = 1);
+        // Delete the given surface
+        virtual bool Delete(cGL_Surface* obj, bool delete_data = 1);
+
+        /* Return the surface by path
+         * if more surfaces have the same path the first added is returned
+        */
         cGL_Surface* Get_Pointer(const boost::filesystem::path& path) const;
 
         // Return the copied image
@@ -108,8 +119,26 @@ namespace TSC {
 
         // highest opengl texture id found
         GLuint m_high_texture_id;
+        // atlas pages of the loaded images
+        cTexture_Atlas m_texture_atlas;
+
+        // path lookups which found a surface
+        mutable unsigned long m_path_hits;
+        // path lookups which found no surface
+        mutable unsigned long m_path_misses;
 
     private:
+        /* Return the key of the path in the path map
+         * paths with the same elements have the same key
+        */
+        static std::string Get_Path_Key(const boost::filesystem::path& path);
+        // Remove the surface from the path map
+        void Remove_Path(cGL_Surface* obj);
+
+        // surfaces by path key
+        GL_Surface_Path_Map m_paths;
+        // path key of every surface as it was added
+        GL_Surface_Key_Map m_path_keys;
         // saved textures for reloading
         Saved_Texture_List m_saved_textures;
     };
@@ -243,6 +243,7 @@ cImage_Settings_Parser::cImage_Settings_Parser(void)
 {
     m_settings_temp = NULL;
     m_load_base = 1;
+    m_cache_parser = this;
 }
 
 cImage_Settings_Parser::~cImage_Settings_Parser(void)
@@ -252,13 +253,75 @@ cImage_Settings_Parser::~cImage_Settings_Parser(void)
 
 cImage_Settings_Data* cImage_Settings_Parser::Get(const boost::filesystem::path& filename, bool load_base_settings /* = 1 */)
 {
-    m_load_base = load_base_settings;
-    m_settings_temp = new cImage_Settings_Data();
+    return new cImage_Settings_Data(Get_Entry(filename, load_base_settings).m_data);
+}
 
-    Parse(filename);
-    cImage_Settings_Data* settings = m_settings_temp;
-    m_settings_temp = NULL;
-    return settings;
+void cImage_Settings_Parser::Preload(const fs::path& dir)
+{
+    vector<fs::path> files = Get_Directory_Files(dir, ".settings");
+
+    for (vector<fs::path>::const_iterator itr = files.begin(); itr != files.end(); ++itr) {
+        Get_Entry(*itr, 1);
+    }
+}
+
+void cImage_Settings_Parser::Clear_Cache(void)
+{
+    m_cache.clear();
+}
+
+const cImage_Settings_Cache_Entry& cImage_Settings_Parser::Get_Entry(const fs::path& filename, bool load_base_settings)
+{
+    const Settings_Cache_Key key(path_to_utf8(filename), load_base_settings);
+    Settings_Cache::iterator itr = m_cache.find(key);
+
+    if (itr != m_cache.end() && Is_Up_To_Date(itr->second)) {
+        return itr->second;
+    }
+
+    /* a new parser as this one may be parsing the file based on it
+     * entry references stay valid when the cache grows
+    */
+    cImage_Settings_Parser parser;
+    parser.m_cache_parser = this;
+    parser.m_load_base = load_base_settings;
+    parser.m_settings_temp = new cImage_Settings_Data();
+
+    boost::system::error_code error;
+    const std::time_t write_time = fs::last_write_time(filename, error);
+
+    if (!error) {
+        parser.m_files_temp.push_back(std::make_pair(filename, write_time));
+    }
+
+    parser.Parse(filename);
+
+    cImage_Settings_Cache_Entry& entry = m_cache[key];
+    entry.m_data = *parser.m_settings_temp;
+    entry.m_files = parser.m_files_temp;
+
+    delete parser.m_settings_temp;
+    parser.m_settings_temp = NULL;
+
+    return entry;
+}
+
+bool cImage_Settings_Parser::Is_Up_To_Date(const cImage_Settings_Cache_Entry& entry)
+{
+    // not found when parsed
+    if (entry.m_files.empty()) {
+        return 0;
+    }
+
+    for (vector<pair<fs::path, std::time_t> >::const_iterator itr = entry.m_files.begin(); itr != entry.m_files.end(); ++itr) {
+        boost::system::error_code error;
+
+        if (fs::last_write_time(itr->first, error) != itr->second || error) {
+            return 0;
+        }
+    }
+
+    return 1;
 }
 
 bool cImage_Settings_Parser::HandleMessage(const std::string* parts, unsigned int count, unsigned int line)
@@ -297,24 +360,20 @@ bool cImage_Settings_Parser::HandleMessage(const std::string* parts, unsigned in
                         break;
                     }
 
-                    // create new temporary parser
-                    cImage_Settings_Parser* temp_parser = new cImage_Settings_Parser();
-                    cImage_Settings_Data* base_settings = temp_parser->Get(settings_file);
-                    // finished loading base settings
-                    delete temp_parser;
+                    // from the cache
+                    const cImage_Settings_Cache_Entry& base_entry = m_cache_parser->Get_Entry(settings_file, 1);
+                    const cImage_Settings_Data* base_settings = &base_entry.m_data;
                     settings_file.clear();
 
-                    // handle
-                    if (base_settings) {
-                        // todo : apply settings in reverse order ( deepest settings should override first )
-                        m_settings_temp->Apply_Base(base_settings);
+                    // modifying the base settings file also invalidates this one
+                    m_files_temp.insert(m_files_temp.end(), base_entry.m_files.begin(), base_entry.m_files.end());
 
-                        // if also based on settings
-                        if (!base_settings->m_base.empty() && base_settings->m_base_settings) {
-                            settings_file = base_settings->m_base;
-                        }
+                    // todo : apply settings in reverse order ( deepest settings should override first )
+                    m_settings_temp->Apply_Base(base_settings);
 
-                        delete base_settings;
+                    // if also based on settings
+                    if (!base_settings->m_base.empty() && base_settings->m_base_settings) {
+                        settings_file = base_settings->m_base;
                     }
                 }
             }
@@ -71,6 +71,15 @@ namespace TSC {
         bool m_obsolete;
     };
 
+    /* *** *** *** *** *** *** cImage_Settings_Cache_Entry *** *** *** *** *** *** *** *** *** *** *** */
+
+    // parsed settings file
+    struct cImage_Settings_Cache_Entry {
+        cImage_Settings_Data m_data;
+        // settings files it was loaded from and their modification time
+        std::vector<std::pair<boost::filesystem::path, std::time_t> > m_files;
+    };
+
     /* *** *** *** *** *** *** cImage_Settings_Parser *** *** *** *** *** *** *** *** *** *** *** */
 
     class cImage_Settings_Parser : public cFile_parser {
@@ -81,9 +90,15 @@ namespace TSC {
         /* Returns the settings from the given file
          * load_base_settings : if set will overwrite settings with all base settings if available
          * The returned settings data should be deleted if not used anymore
+         * Parsed files are cached until one of their settings files is modified.
         */
         cImage_Settings_Data* Get(const boost::filesystem::path& filename, bool load_base_settings = 1);
 
+        // Parse and cache all settings files in the directory and its sub-directories
+        void Preload(const boost::filesystem::path& dir);
+        // Remove all cached settings
+        void Clear_Cache(void);
+
         // Handle one tokenized line
         virtual bool HandleMessage(const std::string* parts, unsigned int count, unsigned int line);
 
@@ -91,6 +106,22 @@ namespace TSC {
         cImage_Settings_Data* m_settings_temp;
         // load base settings
         bool m_load_base;
+
+    private:
+        typedef std::pair<std::string, bool> Settings_Cache_Key;
+        typedef boost::unordered_map<Settings_Cache_Key, cImage_Settings_Cache_Entry> Settings_Cache;
+
+        // Return the cached settings and parse them if not cached or modified
+        const cImage_Settings_Cache_Entry& Get_Entry(const boost::filesystem::path& filename, bool load_base_settings);
+        // Return true if none of the settings files was modified
+        static bool Is_Up_To_Date(const cImage_Settings_Cache_Entry& entry);
+
+        // parser with the cache used for the base settings
+        cImage_Settings_Parser* m_cache_parser;
+        // settings files of the settings currently loaded
+        std::vector<std::pair<boost::filesystem::path, std::time_t> > m_files_temp;
+        // parsed settings
+        Settings_Cache m_cache;
     };
 
     /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
@@ -28,9 +28,84 @@ namespace TSC {
 
 const float doubled_pi = static_cast<float>(M_PI * 2.0f);
 static GLuint last_bind_texture = 0;
+// camera position of the current render
+static float render_camera_x = 0.0f;
+static float render_camera_y = 0.0f;
+
+/* *** *** *** *** *** *** cRender_Request_Pool *** *** *** *** *** *** *** *** *** *** *** */
+
+// pool item size steps
+static const size_t render_pool_size_step = 16;
+// number of pools, larger requests use the default allocation
+static const size_t render_pool_count = 24;
+// number of requests allocated at once if a free list is empty
+static const unsigned int render_pool_block_size = 128;
+
+/* Free list of one request size
+ * requests are deleted in the render thread if it is used
+*/
+class cRender_Request_Pool {
+public:
+    void* Alloc(size_t item_size)
+    {
+        boost::lock_guard<boost::mutex> lock(m_mutex);
+
+        if (m_free_list.empty()) {
+            char* block = static_cast<char*>(::operator new(item_size * render_pool_block_size));
+
+            for (unsigned int i = 0; i < render_pool_block_size; i++) {
+                m_free_list.push_back(block + (i * item_size));
+            }
+        }
+
+        void* ptr = m_free_list.back();
+        m_free_list.pop_back();
+
+        return ptr;
+    }
+
+    void Free(void* ptr)
+    {
+        boost::lock_guard<boost::mutex> lock(m_mutex);
+        m_free_list.push_back(ptr);
+    }
+
+private:
+    vector<void*> m_free_list;
+    boost::mutex m_mutex;
+};
+
+static cRender_Request_Pool render_request_pools[render_pool_count];
 
 /* *** *** *** *** *** *** cRender_Request *** *** *** *** *** *** *** *** *** *** *** */
 
+void* cRender_Request::operator new(size_t size)
+{
+    const size_t pool_num = (size + render_pool_size_step - 1) / render_pool_size_step;
+
+    if (!pool_num || pool_num > render_pool_count) {
+        return ::operator new(size);
+    }
+
+    return render_request_pools[pool_num - 1].Alloc(pool_num * render_pool_size_step);
+}
+
+void cRender_Request::operator delete(void* ptr, size_t size)
+{
+    if (!ptr) {
+        return;
+    }
+
+    const size_t pool_num = (size + render_pool_size_step - 1) / render_pool_size_step;
+
+    if (!pool_num || pool_num > render_pool_count) {
+        ::operator delete(ptr);
+        return;
+    }
+
+    render_request_pools[pool_num - 1].Free(ptr);
+}
+
 cRender_Request::cRender_Request(void)
 {
     m_type = REND_NOTHING;
@@ -48,6 +123,11 @@ void cRender_Request::Draw(void)
     // virtual
 }
 
+Uint32 cRender_Request::Get_State_Key(void) const
+{
+    return 0;
+}
+
 /* *** *** *** *** *** *** cClear_Request *** *** *** *** *** *** *** *** *** *** *** */
 
 cClear_Request::cClear_Request(void)
@@ -167,6 +247,46 @@ void cRender_Request_Advanced::Render_Advanced_Clear(void) const
     }
 }
 
+void cRender_Request_Advanced::Render_Batch_State(void) const
+{
+    // vertices are already transformed
+    glLoadIdentity();
+
+    // blend factor
+    if (m_blend_sfactor != GL_SRC_ALPHA || m_blend_dfactor != GL_ONE_MINUS_SRC_ALPHA) {
+        glBlendFunc(m_blend_sfactor, m_blend_dfactor);
+    }
+
+    // Color Combine
+    if (m_combine_type != 0) {
+        glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_COMBINE);
+        glTexEnvi(GL_TEXTURE_ENV, GL_COMBINE_RGB, m_combine_type);
+        glTexEnvi(GL_TEXTURE_ENV, GL_SOURCE0_RGB, GL_CONSTANT);
+        glTexEnvfv(GL_TEXTURE_ENV, GL_TEXTURE_ENV_COLOR, m_combine_color);
+        glTexEnvi(GL_TEXTURE_ENV, GL_SOURCE1_RGB, GL_TEXTURE);
+    }
+}
+
+void cRender_Request_Advanced::Render_Batch_State_Clear(void) const
+{
+    Render_Advanced_Clear();
+    Render_Basic_Clear();
+}
+
+Uint32 cRender_Request_Advanced::Get_State_Key(void) const
+{
+    Uint32 key = 0;
+
+    if (m_blend_sfactor != GL_SRC_ALPHA || m_blend_dfactor != GL_ONE_MINUS_SRC_ALPHA) {
+        key |= 1;
+    }
+    if (m_combine_type != 0) {
+        key |= 2;
+    }
+
+    return key;
+}
+
 /* *** *** *** *** *** *** cLine_Request *** *** *** *** *** *** *** *** *** *** *** */
 
 cLine_Request::cLine_Request(void)
@@ -190,7 +310,7 @@ void cLine_Request::Draw(void)
 
     // set camera position
     if (!m_no_camera) {
-        glTranslatef(-pActive_Camera->m_x, -pActive_Camera->m_y, m_pos_z);
+        glTranslatef(-render_camera_x, -render_camera_y, m_pos_z);
     }
     else {
         // only z position
@@ -277,8 +397,8 @@ void cRect_Request::Draw(void)
 
     // set camera position
     if (!m_no_camera) {
-        final_pos_x -= pActive_Camera->m_x;
-        final_pos_y -= pActive_Camera->m_y;
+        final_pos_x -= render_camera_x;
+        final_pos_y -= render_camera_y;
     }
 
     glTranslatef(final_pos_x, final_pos_y, m_pos_z);
@@ -366,7 +486,7 @@ void cGradient_Request::Draw(void)
 
     // set camera position
     if (!m_no_camera) {
-        glTranslatef(m_rect.m_x - pActive_Camera->m_x, m_rect.m_y - pActive_Camera->m_y, m_pos_z);
+        glTranslatef(m_rect.m_x - render_camera_x, m_rect.m_y - render_camera_y, m_pos_z);
     }
     // ignore camera position
     else {
@@ -432,7 +552,7 @@ void cCircle_Request::Draw(void)
 
     // set camera position
     if (!m_no_camera) {
-        glTranslatef(m_pos.m_x - pActive_Camera->m_x, m_pos.m_y - pActive_Camera->m_y, m_pos_z);
+        glTranslatef(m_pos.m_x - render_camera_x, m_pos.m_y - render_camera_y, m_pos_z);
     }
     // ignore camera position
     else {
@@ -507,6 +627,7 @@ cSurface_Request::cSurface_Request(void)
 {
     m_type = REND_SURFACE;
     m_texture_id = 0;
+    m_tex_coords = GL_rect(0.0f, 0.0f, 1.0f, 1.0f);
 
     m_pos_x = 0.0f;
     m_pos_y = 0.0f;
@@ -585,8 +706,8 @@ void cSurface_Request::Draw(void)
 
     // set camera position
     if (!m_no_camera) {
-        final_pos_x -= pActive_Camera->m_x;
-        final_pos_y -= pActive_Camera->m_y;
+        final_pos_x -= render_camera_x;
+        final_pos_y -= render_camera_y;
     }
 
     glTranslatef(final_pos_x, final_pos_y, m_pos_z);
@@ -613,22 +734,27 @@ void cSurface_Request::Draw(void)
         last_bind_texture = m_texture_id;
     }
 
+    const float tex_x1 = m_tex_coords.m_x;
+    const float tex_y1 = m_tex_coords.m_y;
+    const float tex_x2 = m_tex_coords.m_x + m_tex_coords.m_w;
+    const float tex_y2 = m_tex_coords.m_y + m_tex_coords.m_h;
+
     /* vertex arrays should not be used to draw simple primitives as it
      * does have no positive performance gain
     */
     // rectangle
     glBegin(GL_QUADS);
     // top left
-    glTexCoord2f(0.0f, 0.0f);
+    glTexCoord2f(tex_x1, tex_y1);
     glVertex2f(-half_w, -half_h);
     // top right
-    glTexCoord2f(1.0f, 0.0f);
+    glTexCoord2f(tex_x2, tex_y1);
     glVertex2f(half_w, -half_h);
     // bottom right
-    glTexCoord2f(1.0f, 1.0f);
+    glTexCoord2f(tex_x2, tex_y2);
     glVertex2f(half_w, half_h);
     // bottom left
-    glTexCoord2f(0.0f, 1.0f);
+    glTexCoord2f(tex_x1, tex_y2);
     glVertex2f(-half_w, half_h);
     glEnd();
 
@@ -644,11 +770,236 @@ void cSurface_Request::Draw(void)
     Render_Basic_Clear();
 }
 
+bool cSurface_Request::Is_Batchable(bool shader) const
+{
+    // the shader combine is a vertex attribute
+    if (shader) {
+        return cSprite_Shader::Get_Combine_Mode(m_combine_type) >= 0;
+    }
+
+    /* the shadow quad needs a constant color which is added as secondary color
+     * this only gives the same result without a combine
+    */
+    return !m_shadow_pos || (m_combine_type == 0 && GLEW_VERSION_1_4);
+}
+
+bool cSurface_Request::Is_Same_Batch(const cSurface_Request* obj, bool shader) const
+{
+    if (m_texture_id != obj->m_texture_id || m_blend_sfactor != obj->m_blend_sfactor || m_blend_dfactor != obj->m_blend_dfactor) {
+        return 0;
+    }
+
+    if (shader) {
+        return 1;
+    }
+
+    if (m_combine_type != obj->m_combine_type) {
+        return 0;
+    }
+
+    // combine color is only used with a combine type
+    if (m_combine_type != 0 && (m_combine_color[0] != obj->m_combine_color[0] || m_combine_color[1] != obj->m_combine_color[1] || m_combine_color[2] != obj->m_combine_color[2])) {
+        return 0;
+    }
+
+    return 1;
+}
+
+Uint32 cSurface_Request::Get_State_Key(void) const
+{
+    // texture in the upper bits
+    return (m_texture_id << 8) | cRender_Request_Advanced::Get_State_Key();
+}
+
+void cSurface_Request::Add_Batch_Vertices(RenderVertexList& vertices) const
+{
+    // shadow as in Draw
+    if (m_shadow_pos) {
+        Color shadow_color = black;
+        shadow_color.alpha = m_shadow_color.alpha;
+
+        const float shadow_combine_color[3] = {
+            static_cast<float>(m_shadow_color.red) / 260,
+            static_cast<float>(m_shadow_color.green) / 260,
+            static_cast<float>(m_shadow_color.blue) / 260
+        };
+
+        Add_Batch_Quad(vertices, m_shadow_pos, -0.000001f, shadow_color, SHADER_COMBINE_REPLACE, shadow_combine_color);
+    }
+
+    Add_Batch_Quad(vertices, 0.0f, 0.0f, m_color, cSprite_Shader::Get_Combine_Mode(m_combine_type), m_combine_color);
+}
+
+void cSurface_Request::Add_Batch_Quad(RenderVertexList& vertices, float offset, float z_offset, const Color& color, int combine_mode, const float* combine_color) const
+{
+    // get half the size
+    const float half_w = m_w / 2;
+    const float half_h = m_h / 2;
+    // position
+    float final_pos_x = m_pos_x + offset + (half_w * m_scale_x);
+    float final_pos_y = m_pos_y + offset + (half_h * m_scale_y);
+
+    // set camera position
+    if (!m_no_camera) {
+        final_pos_x -= render_camera_x;
+        final_pos_y -= render_camera_y;
+    }
+
+    float global_scale_x = 1.0f;
+    float global_scale_y = 1.0f;
+
+    if (m_global_scale) {
+        global_scale_x = global_upscalex;
+        global_scale_y = global_upscaley;
+    }
+
+    // the same transformation as the matrix operations in Draw
+    const float rad_x = m_rot_x * static_cast<float>(M_PI / 180.0);
+    const float rad_y = m_rot_y * static_cast<float>(M_PI / 180.0);
+    const float rad_z = m_rot_z * static_cast<float>(M_PI / 180.0);
+    const float sin_x = sin(rad_x), cos_x = cos(rad_x);
+    const float sin_y = sin(rad_y), cos_y = cos(rad_y);
+    const float sin_z = sin(rad_z), cos_z = cos(rad_z);
+
+    // top left, top right, bottom right, bottom left
+    static const float corner_x[4] = { -1.0f, 1.0f, 1.0f, -1.0f };
+    static const float corner_y[4] = { -1.0f, -1.0f, 1.0f, 1.0f };
+    static const float tex_u[4] = { 0.0f, 1.0f, 1.0f, 0.0f };
+    static const float tex_v[4] = { 0.0f, 0.0f, 1.0f, 1.0f };
+
+    for (unsigned int i = 0; i < 4; i++) {
+        float x = corner_x[i] * half_w;
+        float y = corner_y[i] * half_h;
+        float z = 0.0f;
+
+        // rotate z
+        float temp = x * cos_z - y * sin_z;
+        y = x * sin_z + y * cos_z;
+        x = temp;
+        // rotate y
+        temp = x * cos_y + z * sin_y;
+        z = -x * sin_y + z * cos_y;
+        x = temp;
+        // rotate x
+        temp = y * cos_x - z * sin_x;
+        z = y * sin_x + z * cos_x;
+        y = temp;
+
+        cRender_Vertex vertex;
+        vertex.m_x = (final_pos_x + x * m_scale_x) * global_scale_x;
+        vertex.m_y = (final_pos_y + y * m_scale_y) * global_scale_y;
+        vertex.m_z = m_pos_z + z_offset + z * m_scale_z;
+        vertex.m_u = m_tex_coords.m_x + tex_u[i] * m_tex_coords.m_w;
+        vertex.m_v = m_tex_coords.m_y + tex_v[i] * m_tex_coords.m_h;
+        vertex.m_color[0] = color.red;
+        vertex.m_color[1] = color.green;
+        vertex.m_color[2] = color.blue;
+        vertex.m_color[3] = color.alpha;
+        // also the secondary color without the shader and must be black if not combined
+        if (combine_mode == SHADER_COMBINE_NONE) {
+            vertex.m_combine[0] = 0.0f;
+            vertex.m_combine[1] = 0.0f;
+            vertex.m_combine[2] = 0.0f;
+        }
+        else {
+            vertex.m_combine[0] = combine_color[0];
+            vertex.m_combine[1] = combine_color[1];
+            vertex.m_combine[2] = combine_color[2];
+        }
+
+        vertex.m_combine[3] = static_cast<GLfloat>(combine_mode);
+        vertices.push_back(vertex);
+    }
+}
+
+/* *** *** *** *** *** *** cStatic_Request *** *** *** *** *** *** *** *** *** *** *** */
+
+cStatic_Request::cStatic_Request(void)
+    : cRender_Request_Advanced()
+{
+    m_type = REND_STATIC;
+    m_no_camera = 0;
+    m_texture_id = 0;
+
+    m_pos_x = 0.0f;
+    m_pos_y = 0.0f;
+}
+
+cStatic_Request::~cStatic_Request(void)
+{
+
+}
+
+void cStatic_Request::Draw(void)
+{
+    if (!m_vertices || m_vertices->empty()) {
+        return;
+    }
+
+    Render_Basic();
+
+    float final_pos_x = m_pos_x;
+    float final_pos_y = m_pos_y;
+
+    // set camera position
+    if (!m_no_camera) {
+        final_pos_x -= render_camera_x;
+        final_pos_y -= render_camera_y;
+    }
+
+    glTranslatef(final_pos_x, final_pos_y, 0.0f);
+
+    if (!glIsEnabled(GL_TEXTURE_2D)) {
+        glEnable(GL_TEXTURE_2D);
+    }
+
+    // only bind if not the same texture
+    if (last_bind_texture != m_texture_id) {
+        glBindTexture(GL_TEXTURE_2D, m_texture_id);
+        last_bind_texture = m_texture_id;
+    }
+
+    const GLsizei stride = sizeof(cRender_Vertex);
+    const cRender_Vertex* vertices = &(*m_vertices)[0];
+
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+    glEnableClientState(GL_COLOR_ARRAY);
+
+    glVertexPointer(3, GL_FLOAT, stride, &vertices->m_x);
+    glTexCoordPointer(2, GL_FLOAT, stride, &vertices->m_u);
+    glColorPointer(4, GL_UNSIGNED_BYTE, stride, vertices->m_color);
+
+    glDrawArrays(GL_QUADS, 0, static_cast<GLsizei>(m_vertices->size()));
+
+    glDisableClientState(GL_COLOR_ARRAY);
+    glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+    glDisableClientState(GL_VERTEX_ARRAY);
+
+    // the current color is undefined after using a color array
+    glColor4f(1.0f, 1.0f, 1.0f, 1.0f);
+
+    Render_Basic_Clear();
+}
+
+Uint32 cStatic_Request::Get_State_Key(void) const
+{
+    // texture in the upper bits
+    return (m_texture_id << 8) | cRender_Request_Advanced::Get_State_Key();
+}
+
 /* *** *** *** *** *** *** cRenderQueue *** *** *** *** *** *** *** *** *** *** *** */
 
 cRenderQueue::cRenderQueue(unsigned int reserve_items)
 {
     m_render_data.reserve(reserve_items);
+    m_batch_vertices.reserve(reserve_items * 4);
+    m_batch_surfaces = 1;
+    m_draw_calls = 0;
+
+    m_camera_x = 0.0f;
+    m_camera_y = 0.0f;
+    m_camera_saved = 0;
 }
 
 cRenderQueue::~cRenderQueue(void)
@@ -668,21 +1019,69 @@ void cRenderQueue::Add(cRender_Request* obj)
         return;
     }
 
+    // textured requests without texture as the image is still loaded in the background
+    if ((obj->m_type == REND_SURFACE && !static_cast<cSurface_Request*>(obj)->m_texture_id) ||
+        (obj->m_type == REND_STATIC && !static_cast<cStatic_Request*>(obj)->m_texture_id)) {
+        delete obj;
+        return;
+    }
+
     m_render_data.push_back(obj);
 }
 
 void cRenderQueue::Render(bool clear /* = 1 */)
 {
-    // z position sort
-    std::sort(m_render_data.begin(), m_render_data.end(), zpos_sort());
+    Sort();
     // reset last texture
     last_bind_texture = 0;
 
-    for (RenderList::iterator itr = m_render_data.begin(); itr != m_render_data.end(); ++itr) {
+    if (m_camera_saved) {
+        render_camera_x = m_camera_x;
+        render_camera_y = m_camera_y;
+        m_camera_saved = 0;
+    }
+    else {
+        render_camera_x = pActive_Camera->m_x;
+        render_camera_y = pActive_Camera->m_y;
+    }
+
+    m_draw_calls = 0;
+    // draw the batches with the sprite shader if available
+    const bool use_shader = pVideo->m_sprite_shader.Is_Ready();
+
+    for (RenderList::iterator itr = m_render_data.begin(); itr != m_render_data.end();) {
         cRender_Request* obj = (*itr);
 
+        if (m_batch_surfaces && obj->m_type == REND_SURFACE && static_cast<cSurface_Request*>(obj)->Is_Batchable(use_shader)) {
+            const cSurface_Request* surface_obj = static_cast<cSurface_Request*>(obj);
+            RenderList::iterator batch_end = itr + 1;
+
+            // find the following requests with the same state
+            while (batch_end != m_render_data.end() && (*batch_end)->m_type == REND_SURFACE) {
+                const cSurface_Request* next_obj = static_cast<cSurface_Request*>(*batch_end);
+
+                if (!next_obj->Is_Batchable(use_shader) || !surface_obj->Is_Same_Batch(next_obj, use_shader)) {
+                    break;
+                }
+
+                ++batch_end;
+            }
+
+            // a single surface is faster in immediate mode but not with its shadow
+            if (batch_end - itr > 1 || surface_obj->m_shadow_pos) {
+                Draw_Surface_Batch(itr, batch_end, use_shader);
+                itr = batch_end;
+                continue;
+            }
+        }
+
         obj->Draw();
-        obj->m_render_count--;
+        m_draw_calls++;
+        ++itr;
+    }
+
+    for (RenderList::iterator itr = m_render_data.begin(); itr != m_render_data.end(); ++itr) {
+        (*itr)->m_render_count--;
     }
 
     if (clear) {
@@ -690,6 +1089,156 @@ void cRenderQueue::Render(bool clear /* = 1 */)
     }
 }
 
+void cRenderQueue::Sort(void)
+{
+    const size_t count = m_render_data.size();
+
+    m_sort_items.resize(count);
+    m_sort_temp.resize(count);
+
+    for (size_t i = 0; i < count; i++) {
+        cRender_Request* obj = m_render_data[i];
+
+        // float bits in unsigned integer order
+        Uint32 z_bits;
+        memcpy(&z_bits, &obj->m_pos_z, sizeof(z_bits));
+        z_bits = (z_bits & 0x80000000) ? ~z_bits : (z_bits | 0x80000000);
+
+        m_sort_items[i].m_key = (static_cast<Uint64>(z_bits) << 32) | obj->Get_State_Key();
+        m_sort_items[i].m_obj = obj;
+    }
+
+    // least significant byte first radix sort is stable
+    for (unsigned int shift = 0; shift < 64; shift += 8) {
+        size_t offsets[256] = { 0 };
+
+        for (size_t i = 0; i < count; i++) {
+            offsets[(m_sort_items[i].m_key >> shift) & 0xFF]++;
+        }
+
+        // all keys have the same byte
+        if (count && offsets[(m_sort_items[0].m_key >> shift) & 0xFF] == count) {
+            continue;
+        }
+
+        size_t pos = 0;
+
+        for (unsigned int digit = 0; digit < 256; digit++) {
+            const size_t digit_count = offsets[digit];
+            offsets[digit] = pos;
+            pos += digit_count;
+        }
+
+        for (size_t i = 0; i < count; i++) {
+            m_sort_temp[offsets[(m_sort_items[i].m_key >> shift) & 0xFF]++] = m_sort_items[i];
+        }
+
+        m_sort_items.swap(m_sort_temp);
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        m_render_data[i] = m_sort_items[i].m_obj;
+    }
+}
+
+void cRenderQueue::Draw_Surface_Batch(RenderList::iterator start, RenderList::iterator end, bool shader)
+{
+    m_batch_vertices.clear();
+    // shadow quads are added in the same batch
+    bool shadow = 0;
+
+    for (RenderList::iterator itr = start; itr != end; ++itr) {
+        const cSurface_Request* obj = static_cast<cSurface_Request*>(*itr);
+
+        obj->Add_Batch_Vertices(m_batch_vertices);
+
+        if (obj->m_shadow_pos) {
+            shadow = 1;
+        }
+    }
+
+    const cSurface_Request* first_obj = static_cast<cSurface_Request*>(*start);
+
+    first_obj->Render_Batch_State();
+
+    if (!glIsEnabled(GL_TEXTURE_2D)) {
+        glEnable(GL_TEXTURE_2D);
+    }
+
+    // only bind if not the same texture
+    if (last_bind_texture != first_obj->m_texture_id) {
+        glBindTexture(GL_TEXTURE_2D, first_obj->m_texture_id);
+        last_bind_texture = first_obj->m_texture_id;
+    }
+
+    const GLsizei stride = sizeof(cRender_Vertex);
+    // the pointers are offsets into the buffer if the vertices are uploaded
+    const GLubyte* vertices = NULL;
+
+    if (pVideo->m_batch_buffer) {
+        glBindBuffer(GL_ARRAY_BUFFER, pVideo->m_batch_buffer);
+        // new storage for every batch so the driver does not wait for the previous draw
+        glBufferData(GL_ARRAY_BUFFER, m_batch_vertices.size() * stride, &m_batch_vertices[0], GL_STREAM_DRAW);
+    }
+    else {
+        vertices = reinterpret_cast<const GLubyte*>(&m_batch_vertices[0]);
+    }
+
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+    glEnableClientState(GL_COLOR_ARRAY);
+
+    glVertexPointer(3, GL_FLOAT, stride, vertices + offsetof(cRender_Vertex, m_x));
+    glTexCoordPointer(2, GL_FLOAT, stride, vertices + offsetof(cRender_Vertex, m_u));
+    glColorPointer(4, GL_UNSIGNED_BYTE, stride, vertices + offsetof(cRender_Vertex, m_color));
+
+    // the shader replaces the texture environment combine
+    if (shader) {
+        pVideo->m_sprite_shader.Enable();
+        glEnableVertexAttribArray(pVideo->m_sprite_shader.m_combine_location);
+        glVertexAttribPointer(pVideo->m_sprite_shader.m_combine_location, 4, GL_FLOAT, GL_FALSE, stride, vertices + offsetof(cRender_Vertex, m_combine));
+    }
+    // the shadow color is added as secondary color
+    else if (shadow) {
+        glEnable(GL_COLOR_SUM);
+        glEnableClientState(GL_SECONDARY_COLOR_ARRAY);
+        glSecondaryColorPointer(3, GL_FLOAT, stride, vertices + offsetof(cRender_Vertex, m_combine));
+    }
+
+    glDrawArrays(GL_QUADS, 0, static_cast<GLsizei>(m_batch_vertices.size()));
+    m_draw_calls++;
+
+    if (shader) {
+        glDisableVertexAttribArray(pVideo->m_sprite_shader.m_combine_location);
+        pVideo->m_sprite_shader.Disable();
+    }
+    else if (shadow) {
+        glDisableClientState(GL_SECONDARY_COLOR_ARRAY);
+        glDisable(GL_COLOR_SUM);
+    }
+
+    glDisableClientState(GL_COLOR_ARRAY);
+    glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+    glDisableClientState(GL_VERTEX_ARRAY);
+
+    // other client arrays are not in the buffer
+    if (pVideo->m_batch_buffer) {
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+
+    // the current color is undefined after using a color array
+    glColor4f(1.0f, 1.0f, 1.0f, 1.0f);
+
+    first_obj->Render_Batch_State_Clear();
+}
+
+void cRenderQueue::Save_Camera(void)
+{
+    m_camera_x = pActive_Camera->m_x;
+    m_camera_y = pActive_Camera->m_y;
+    m_camera_saved = 1;
+}
+
 void cRenderQueue::Fake_Render(unsigned int amount /* = 1 */, bool clear /* = 1 */)
 {
     for (RenderList::iterator itr = m_render_data.begin(); itr != m_render_data.end(); ++itr) {
@@ -704,19 +1253,23 @@ void cRenderQueue::Fake_Render(unsigned int amount /* = 1 */, bool clear /* = 1
 
 void cRenderQueue::Clear(bool force /* = 1 */)
 {
-    for (RenderList::iterator itr = m_render_data.begin(); itr != m_render_data.end();) {
+    // requests which render again are moved to the front in the same order
+    RenderList::iterator keep_itr = m_render_data.begin();
+
+    for (RenderList::iterator itr = m_render_data.begin(); itr != m_render_data.end(); ++itr) {
         cRender_Request* obj = (*itr);
 
         // if forced or finished rendering
         if (force || obj->m_render_count <= 0) {
-            itr = m_render_data.erase(itr);
             delete obj;
         }
-        // increment
         else {
-            ++itr;
+            (*keep_itr) = obj;
+            ++keep_itr;
         }
     }
+
+    m_render_data.erase(keep_itr, m_render_data.end());
 }
 
 /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
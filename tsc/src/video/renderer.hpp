@@ -33,7 +33,8 @@ namespace TSC {
         REND_SURFACE = 4,
         REND_TEXT = 5, // todo
         REND_LINE = 6,
-        REND_CIRCLE = 7
+        REND_CIRCLE = 7,
+        REND_STATIC = 8
     };
 
     /* *** *** *** *** *** *** cRender_Request *** *** *** *** *** *** *** *** *** *** *** */
@@ -43,8 +44,18 @@ namespace TSC {
         cRender_Request(void);
         virtual ~cRender_Request(void);
 
+        /* Requests are created for every drawn object in every frame
+         * so the memory is reused from free lists of the request size
+        */
+        static void* operator new(size_t size);
+        static void operator delete(void* ptr, size_t size);
+
         // draw
         virtual void Draw(void);
+        /* Return the render state used to order requests with the same z position
+         * requests with the same state are next to each other and can be batched
+        */
+        virtual Uint32 Get_State_Key(void) const;
 
         // render type
         RenderType m_type;
@@ -84,6 +95,16 @@ namespace TSC {
         // clear advanced render state
         void Render_Advanced_Clear(void) const;
 
+        /* render the blend and combine state without any transformation
+         * used for batches with already transformed vertices
+        */
+        void Render_Batch_State(void) const;
+        // clear batch render state
+        void Render_Batch_State_Clear(void) const;
+
+        // Return the blend and combine state
+        virtual Uint32 Get_State_Key(void) const;
+
         // global scale
         bool m_global_scale;
         // if not set camera position is subtracted
@@ -190,6 +211,26 @@ namespace TSC {
         float m_line_width;
     };
 
+    /* *** *** *** *** *** *** cRender_Vertex *** *** *** *** *** *** *** *** *** *** *** */
+
+    // transformed vertex of a surface batch
+    struct cRender_Vertex {
+        GLfloat m_x;
+        GLfloat m_y;
+        GLfloat m_z;
+        GLfloat m_u;
+        GLfloat m_v;
+        GLubyte m_color[4];
+        /* combine color and ShaderCombine mode for the sprite shader
+         * without the shader the color is used as secondary color for shadows
+        */
+        GLfloat m_combine[4];
+    };
+
+    typedef vector<cRender_Vertex> RenderVertexList;
+    // shared with the render requests as the render thread may still use it
+    typedef boost::shared_ptr<const RenderVertexList> RenderVertexListPtr;
+
     /* *** *** *** *** *** *** cSurface_Request *** *** *** *** *** *** *** *** *** *** *** */
 
     class cSurface_Request : public cRender_Request_Advanced {
@@ -200,8 +241,21 @@ namespace TSC {
         // Draw
         virtual void Draw(void);
 
+        /* Return true if this can be drawn as part of a batch
+         * shader : if set the batch is drawn with the sprite shader
+        */
+        bool Is_Batchable(bool shader) const;
+        // Return true if the given request uses the same texture and render state
+        bool Is_Same_Batch(const cSurface_Request* obj, bool shader) const;
+        // Add the transformed quad vertices and the shadow quad before if set
+        void Add_Batch_Vertices(RenderVertexList& vertices) const;
+        // Return the texture with the blend and combine state
+        virtual Uint32 Get_State_Key(void) const;
+
         // texture id
         GLuint m_texture_id;
+        // texture coordinates
+        GL_rect m_tex_coords;
         // position
         float m_pos_x;
         float m_pos_y;
@@ -218,6 +272,38 @@ namespace TSC {
 
         // delete texture after request finished
         bool m_delete_texture;
+
+    private:
+        /* Add the transformed quad vertices
+         * offset : added to the position
+         * z_offset : added to the z position
+        */
+        void Add_Batch_Quad(RenderVertexList& vertices, float offset, float z_offset, const Color& color, int combine_mode, const float* combine_color) const;
+    };
+
+    /* *** *** *** *** *** *** cStatic_Request *** *** *** *** *** *** *** *** *** *** *** */
+
+    /* Draws prebuilt quads of one texture with one draw call
+     * The vertices are not transformed by the camera and global scale.
+     * Used for cached geometry which does not change every frame.
+    */
+    class cStatic_Request : public cRender_Request_Advanced {
+    public:
+        cStatic_Request(void);
+        virtual ~cStatic_Request(void);
+
+        // Draw
+        virtual void Draw(void);
+        // Return the texture with the blend state
+        virtual Uint32 Get_State_Key(void) const;
+
+        // texture id
+        GLuint m_texture_id;
+        // added to all vertex positions
+        float m_pos_x;
+        float m_pos_y;
+        // quads with the untransformed positions
+        RenderVertexListPtr m_vertices;
     };
 
     /* *** *** *** *** *** *** cRenderQueue *** *** *** *** *** *** *** *** *** *** *** */
@@ -247,16 +333,47 @@ namespace TSC {
         */
         void Clear(bool force = 1);
 
+        /* Use the current camera position for the next render
+         * needed if rendered in another thread while the camera is updated
+        */
+        void Save_Camera(void);
+
         // render data array
         RenderList m_render_data;
+        // if set consecutive surface requests with the same state are drawn together
+        bool m_batch_surfaces;
+        // draw calls of the last render
+        unsigned int m_draw_calls;
+
+    private:
+        // saved camera position
+        float m_camera_x;
+        float m_camera_y;
+        bool m_camera_saved;
+
+        /* Sort the render data by z position and render state
+         * requests with the same key keep their order
+        */
+        void Sort(void);
 
-        // Z position sort
-        struct zpos_sort {
-            bool operator()(const cRender_Request* a, const cRender_Request* b) const
-            {
-                return a->m_pos_z < b->m_pos_z;
-            }
+        /* Draw the surface requests from start to end with one draw call
+         * all requests must share the same batch state
+         * shader : if set draw with the sprite shader
+        */
+        void Draw_Surface_Batch(RenderList::iterator start, RenderList::iterator end, bool shader);
+
+        // batch vertex buffer
+        RenderVertexList m_batch_vertices;
+
+        struct cSort_Item {
+            Uint64 m_key;
+            cRender_Request* m_obj;
         };
+
+        typedef vector<cSort_Item> Sort_Item_List;
+        // radix sort buffers
+        Sort_Item_List m_sort_items;
+        Sort_Item_List m_sort_temp;
     };
 
     /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
@@ -0,0 +1,176 @@
+/***************************************************************************
+ * sprite_shader.cpp  -  GLSL program for batched sprites
+ *
+ * Copyright © 2013 - 2014 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../video/sprite_shader.hpp"
+
+using namespace std;
+
+namespace TSC {
+
+/* *** *** *** *** *** *** cSprite_Shader *** *** *** *** *** *** *** *** *** *** *** */
+
+static const char* sprite_vertex_shader =
+    "#version 110\n"
+    "attribute vec4 combine_attr;\n"
+    "varying vec4 combine;\n"
+    "void main()\n"
+    "{\n"
+    "    gl_Position = gl_ModelViewProjectionMatrix * gl_Vertex;\n"
+    "    gl_TexCoord[0] = gl_MultiTexCoord0;\n"
+    "    gl_FrontColor = gl_Color;\n"
+    "    combine = combine_attr;\n"
+    "}\n";
+
+// the alpha is always modulated like the fixed function combine alpha
+static const char* sprite_fragment_shader =
+    "#version 110\n"
+    "uniform sampler2D image;\n"
+    "varying vec4 combine;\n"
+    "void main()\n"
+    "{\n"
+    "    vec4 tex = texture2D(image, gl_TexCoord[0].st);\n"
+    "    vec3 rgb;\n"
+    "    if (combine.w < 0.5)\n"
+    "        rgb = tex.rgb * gl_Color.rgb;\n"
+    "    else if (combine.w < 1.5)\n"
+    "        rgb = combine.rgb;\n"
+    "    else if (combine.w < 2.5)\n"
+    "        rgb = combine.rgb * tex.rgb;\n"
+    "    else\n"
+    "        rgb = min(combine.rgb + tex.rgb, 1.0);\n"
+    "    gl_FragColor = vec4(rgb, tex.a * gl_Color.a);\n"
+    "}\n";
+
+cSprite_Shader::cSprite_Shader(void)
+{
+    m_enabled = 1;
+    m_combine_location = -1;
+    m_program = 0;
+}
+
+cSprite_Shader::~cSprite_Shader(void)
+{
+    // deleted with the OpenGL context
+}
+
+bool cSprite_Shader::Init(void)
+{
+    Clear();
+
+    if (!m_enabled || !GLEW_VERSION_2_0) {
+        return 0;
+    }
+
+    GLuint vertex_shader = Compile(GL_VERTEX_SHADER, sprite_vertex_shader);
+    GLuint fragment_shader = Compile(GL_FRAGMENT_SHADER, sprite_fragment_shader);
+
+    if (!vertex_shader || !fragment_shader) {
+        glDeleteShader(vertex_shader);
+        glDeleteShader(fragment_shader);
+        return 0;
+    }
+
+    GLuint program = glCreateProgram();
+    glAttachShader(program, vertex_shader);
+    glAttachShader(program, fragment_shader);
+    glLinkProgram(program);
+
+    // deleted with the program
+    glDeleteShader(vertex_shader);
+    glDeleteShader(fragment_shader);
+
+    GLint linked = 0;
+    glGetProgramiv(program, GL_LINK_STATUS, &linked);
+
+    if (!linked) {
+        char log[1024];
+        glGetProgramInfoLog(program, sizeof(log), NULL, log);
+        cerr << "Warning : Sprite shader link failed, using fixed function rendering" << endl << log << endl;
+        glDeleteProgram(program);
+        return 0;
+    }
+
+    m_program = program;
+    m_combine_location = glGetAttribLocation(m_program, "combine_attr");
+
+    // texture unit 0
+    glUseProgram(m_program);
+    glUniform1i(glGetUniformLocation(m_program, "image"), 0);
+    glUseProgram(0);
+
+    return 1;
+}
+
+void cSprite_Shader::Clear(void)
+{
+    if (m_program && glIsProgram(m_program)) {
+        glDeleteProgram(m_program);
+    }
+
+    m_program = 0;
+    m_combine_location = -1;
+}
+
+int cSprite_Shader::Get_Combine_Mode(GLint combine_type)
+{
+    if (combine_type == 0) {
+        return SHADER_COMBINE_NONE;
+    }
+    else if (combine_type == GL_REPLACE) {
+        return SHADER_COMBINE_REPLACE;
+    }
+    else if (combine_type == GL_MODULATE) {
+        return SHADER_COMBINE_MODULATE;
+    }
+    else if (combine_type == GL_ADD) {
+        return SHADER_COMBINE_ADD;
+    }
+
+    return -1;
+}
+
+void cSprite_Shader::Enable(void) const
+{
+    glUseProgram(m_program);
+}
+
+void cSprite_Shader::Disable(void) const
+{
+    glUseProgram(0);
+}
+
+GLuint cSprite_Shader::Compile(GLenum type, const char* source) const
+{
+    GLuint shader = glCreateShader(type);
+    glShaderSource(shader, 1, &source, NULL);
+    glCompileShader(shader);
+
+    GLint compiled = 0;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &compiled);
+
+    if (!compiled) {
+        char log[1024];
+        glGetShaderInfoLog(shader, sizeof(log), NULL, log);
+        cerr << "Warning : Sprite shader compilation failed, using fixed function rendering" << endl << log << endl;
+        glDeleteShader(shader);
+        return 0;
+    }
+
+    return shader;
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
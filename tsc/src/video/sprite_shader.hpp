@@ -0,0 +1,81 @@
+/***************************************************************************
+ * sprite_shader.h  -  GLSL program for batched sprites
+ *
+ * Copyright © 2013 - 2014 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_SPRITE_SHADER_HPP
+#define TSC_SPRITE_SHADER_HPP
+
+#include "../core/global_basic.hpp"
+
+namespace TSC {
+
+    /* *** *** *** *** *** *** cSprite_Shader *** *** *** *** *** *** *** *** *** *** *** */
+
+    /* Combine mode per vertex
+     * the same as the fixed function texture combine with a constant color
+    */
+    enum ShaderCombine {
+        SHADER_COMBINE_NONE = 0,
+        SHADER_COMBINE_REPLACE = 1,
+        SHADER_COMBINE_MODULATE = 2,
+        SHADER_COMBINE_ADD = 3
+    };
+
+    /* Draws textured quads with the color combine as a vertex attribute
+     * Sprites with different combine colors and their shadows can be drawn
+     * in one batch without changing the texture environment.
+    */
+    class cSprite_Shader {
+    public:
+        cSprite_Shader(void);
+        ~cSprite_Shader(void);
+
+        /* Compile and link the program for the current OpenGL context
+         * returns false if shaders are not supported or failed
+        */
+        bool Init(void);
+        // Delete the program
+        void Clear(void);
+
+        // Return true if the program can be used
+        inline bool Is_Ready(void) const
+        {
+            return m_program != 0;
+        };
+
+        // Return the shader combine mode for the texture combine type or -1 if not supported
+        static int Get_Combine_Mode(GLint combine_type);
+
+        // Use the program
+        void Enable(void) const;
+        // Use the fixed function pipeline
+        void Disable(void) const;
+
+        // if not set the fixed function pipeline is used
+        bool m_enabled;
+        // combine attribute location
+        GLint m_combine_location;
+
+    private:
+        // Compile a shader and return it or 0 if failed
+        GLuint Compile(GLenum type, const char* source) const;
+
+        GLuint m_program;
+    };
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
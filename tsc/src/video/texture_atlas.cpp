@@ -0,0 +1,216 @@
+/***************************************************************************
+ * texture_atlas.cpp  -  packs small images into shared textures
+ *
+ * Copyright © 2013 - 2014 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../video/texture_atlas.hpp"
+#include "../video/video.hpp"
+#include "../video/img_manager.hpp"
+#include "../core/math/utilities.hpp"
+
+using namespace std;
+
+namespace TSC {
+
+/* *** *** *** *** *** *** cTexture_Atlas *** *** *** *** *** *** *** *** *** *** *** */
+
+// border around every image
+static const unsigned int atlas_image_border = 1;
+
+cTexture_Atlas::cTexture_Atlas(void)
+{
+    m_enabled = 1;
+    m_min_page_size = 128;
+    m_page_size = 1024;
+    m_max_image_size = 256;
+    m_memory = 0;
+    m_max_memory = 64 * 1024 * 1024;
+}
+
+cTexture_Atlas::~cTexture_Atlas(void)
+{
+    // the textures are deleted with the GL context
+    Clear(0);
+}
+
+bool cTexture_Atlas::Add(const std::string& group, unsigned int width, unsigned int height, const void* pixels, unsigned int row_length, GLuint& texture_id, GL_rect& tex_coords)
+{
+    if (!m_enabled || width > m_max_image_size || height > m_max_image_size) {
+        return 0;
+    }
+
+    const unsigned int page_size = min(m_page_size, static_cast<unsigned int>(pVideo->m_max_texture_size));
+    const unsigned int padded_w = width + atlas_image_border * 2;
+    const unsigned int padded_h = height + atlas_image_border * 2;
+
+    if (padded_w > page_size || padded_h > page_size) {
+        return 0;
+    }
+
+    // last page of the group
+    cPage* page = NULL;
+
+    for (Page_List::reverse_iterator itr = m_pages.rbegin(); itr != m_pages.rend(); ++itr) {
+        if (itr->m_group == group) {
+            page = &(*itr);
+            break;
+        }
+    }
+
+    // the last page is too small for the image
+    if (page && (padded_w > page->m_size || padded_h > page->m_size)) {
+        page = Create_Page(group, max(padded_w, padded_h));
+
+        if (!page) {
+            return 0;
+        }
+    }
+
+    // start a new shelf
+    if (page && page->m_shelf_x + padded_w > page->m_size) {
+        page->m_shelf_x = 0;
+        page->m_shelf_y += page->m_shelf_h;
+        page->m_shelf_h = 0;
+    }
+
+    // page is full
+    if (!page || page->m_shelf_y + padded_h > page->m_size) {
+        page = Create_Page(group, max(padded_w, padded_h));
+
+        if (!page) {
+            return 0;
+        }
+    }
+
+    // new pages are capped at the maximum page size
+    if (padded_w > page->m_size || padded_h > page->m_size) {
+        return 0;
+    }
+
+    // copy with the edge pixels repeated in the border
+    m_buffer.resize(padded_w * padded_h);
+    const Uint32* src = static_cast<const Uint32*>(pixels);
+
+    for (unsigned int y = 0; y < padded_h; y++) {
+        const unsigned int src_y = min(max(y, atlas_image_border) - atlas_image_border, height - 1);
+        const Uint32* src_row = src + (src_y * row_length);
+        Uint32* dest_row = &m_buffer[y * padded_w];
+
+        for (unsigned int x = 0; x < padded_w; x++) {
+            dest_row[x] = src_row[min(max(x, atlas_image_border) - atlas_image_border, width - 1)];
+        }
+    }
+
+    glBindTexture(GL_TEXTURE_2D, page->m_texture);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, page->m_shelf_x, page->m_shelf_y, padded_w, padded_h, GL_RGBA, GL_UNSIGNED_BYTE, &m_buffer[0]);
+
+    texture_id = page->m_texture;
+    tex_coords.m_x = static_cast<float>(page->m_shelf_x + atlas_image_border) / page->m_size;
+    tex_coords.m_y = static_cast<float>(page->m_shelf_y + atlas_image_border) / page->m_size;
+    tex_coords.m_w = static_cast<float>(width) / page->m_size;
+    tex_coords.m_h = static_cast<float>(height) / page->m_size;
+
+    page->m_shelf_x += padded_w;
+
+    if (page->m_shelf_h < padded_h) {
+        page->m_shelf_h = padded_h;
+    }
+
+    return 1;
+}
+
+bool cTexture_Atlas::Is_Page(GLuint texture_id) const
+{
+    for (Page_List::const_iterator itr = m_pages.begin(); itr != m_pages.end(); ++itr) {
+        if (itr->m_texture == texture_id) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+void cTexture_Atlas::Clear(bool delete_textures /* = 1 */)
+{
+    if (delete_textures) {
+        for (Page_List::iterator itr = m_pages.begin(); itr != m_pages.end(); ++itr) {
+            if (glIsTexture(itr->m_texture)) {
+                glDeleteTextures(1, &itr->m_texture);
+            }
+        }
+    }
+
+    m_pages.clear();
+    m_memory = 0;
+}
+
+cTexture_Atlas::cPage* cTexture_Atlas::Create_Page(const std::string& group, unsigned int min_size)
+{
+    const unsigned int max_page_size = min(m_page_size, static_cast<unsigned int>(pVideo->m_max_texture_size));
+    unsigned int page_size = m_min_page_size;
+
+    // double the size of the last page of the group
+    for (Page_List::reverse_iterator itr = m_pages.rbegin(); itr != m_pages.rend(); ++itr) {
+        if (itr->m_group == group) {
+            page_size = itr->m_size * 2;
+            break;
+        }
+    }
+
+    page_size = min(Get_Power_of_2(max(page_size, min_size)), max_page_size);
+
+    // RGBA
+    const unsigned int page_memory = page_size * page_size * 4;
+
+    if (m_memory + page_memory > m_max_memory) {
+        return NULL;
+    }
+
+    GLuint texture_id = 0;
+    glGenTextures(1, &texture_id);
+
+    // if image id is 0 it failed
+    if (!texture_id) {
+        cerr << "Error : GL atlas page generation failed" << endl;
+        return NULL;
+    }
+
+    // set highest texture id
+    if (pImage_Manager->m_high_texture_id < texture_id) {
+        pImage_Manager->m_high_texture_id = texture_id;
+    }
+
+    glBindTexture(GL_TEXTURE_2D, texture_id);
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    // empty page
+    pVideo->Create_GL_Texture(page_size, page_size, NULL);
+
+    cPage page;
+    page.m_group = group;
+    page.m_texture = texture_id;
+    page.m_size = page_size;
+    page.m_shelf_x = 0;
+    page.m_shelf_y = 0;
+    page.m_shelf_h = 0;
+    m_pages.push_back(page);
+    m_memory += page_memory;
+
+    return &m_pages.back();
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
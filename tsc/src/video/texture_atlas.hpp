@@ -0,0 +1,96 @@
+/***************************************************************************
+ * texture_atlas.h  -  packs small images into shared textures
+ *
+ * Copyright © 2013 - 2014 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_TEXTURE_ATLAS_HPP
+#define TSC_TEXTURE_ATLAS_HPP
+
+#include "../core/global_basic.hpp"
+#include "../core/math/rect.hpp"
+
+namespace TSC {
+
+    /* *** *** *** *** *** *** cTexture_Atlas *** *** *** *** *** *** *** *** *** *** *** */
+
+    /* Packs images of the same group into large texture pages
+     * Images of one group are usually drawn together and with a shared texture
+     * the render queue can batch them and doesn't need to switch the texture.
+     * Every image gets a border with its edge pixels to prevent filtering
+     * with the neighbour images.
+     * The first page of a group has the smallest size the image fits in and
+     * every further page doubles it, so small groups only use small pages.
+    */
+    class cTexture_Atlas {
+    public:
+        cTexture_Atlas(void);
+        ~cTexture_Atlas(void);
+
+        /* Add the image to a page of the given group
+         * pixels : 32 bit RGBA image data
+         * row_length : pixels per row in the image data
+         * texture_id : returns the page texture
+         * tex_coords : returns the image texture coordinates on the page
+         * Returns false if the image should get its own texture.
+        */
+        bool Add(const std::string& group, unsigned int width, unsigned int height, const void* pixels, unsigned int row_length, GLuint& texture_id, GL_rect& tex_coords);
+
+        // Return true if the texture is an atlas page
+        bool Is_Page(GLuint texture_id) const;
+
+        /* Forget all pages
+         * delete_textures : if set delete the page textures
+        */
+        void Clear(bool delete_textures = 1);
+
+        // if not set all images get their own texture
+        bool m_enabled;
+        // smallest and largest page size in pixels
+        unsigned int m_min_page_size;
+        unsigned int m_page_size;
+        // images which are larger in any direction get their own texture
+        unsigned int m_max_image_size;
+        /* memory of all pages in bytes
+         * if a new page would exceed m_max_memory the image gets its own texture
+        */
+        unsigned int m_memory;
+        unsigned int m_max_memory;
+
+    private:
+        struct cPage {
+            std::string m_group;
+            GLuint m_texture;
+            // width and height in pixels
+            unsigned int m_size;
+            // current shelf
+            unsigned int m_shelf_x;
+            unsigned int m_shelf_y;
+            unsigned int m_shelf_h;
+        };
+
+        /* Create a new page for the group
+         * min_size : the page is at least this large
+        */
+        cPage* Create_Page(const std::string& group, unsigned int min_size);
+
+        typedef vector<cPage> Page_List;
+        Page_List m_pages;
+        // padded image buffer
+        vector<Uint32> m_buffer;
+    };
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
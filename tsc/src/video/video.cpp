@@ -23,6 +23,7 @@
 #include "../video/img_settings.hpp"
 #include "../input/mouse.hpp"
 #include "../video/renderer.hpp"
+#include "../core/static_layer.hpp"
 #include "../core/main.hpp"
 #include "../core/math/utilities.hpp"
 #include "../core/i18n.hpp"
@@ -39,6 +40,119 @@ namespace fs = boost::filesystem;
 
 namespace TSC {
 
+// texture names reserved for the render thread
+static const unsigned int render_thread_texture_names = 32;
+// maximum threads loading images in the background
+static const unsigned int async_surface_max_threads = 4;
+// milliseconds used every frame to upload the images loaded in the background
+static const float async_surface_upload_time = 2.0f;
+
+/* *** *** *** *** *** *** *** cImage_Cache_Queue *** *** *** *** *** *** *** *** *** *** */
+
+// image to downscale and save in the image cache
+struct cImage_Cache_Job {
+    // image path
+    fs::path m_filename;
+    // file the image is loaded from
+    fs::path m_source;
+    fs::path m_cache_filename;
+    // image settings which are deleted after the image is saved
+    cImage_Settings_Data* m_settings;
+};
+
+// image cache jobs shared with the worker threads
+struct cImage_Cache_Queue {
+    cImage_Cache_Queue(const cVideo* video)
+        : m_video(video), m_next_job(0), m_done(0) {}
+
+    const cVideo* m_video;
+    vector<cImage_Cache_Job> m_jobs;
+    // guards the positions
+    boost::mutex m_mutex;
+    boost::condition_variable m_condition;
+    // next job not yet taken by a worker
+    size_t m_next_job;
+    // finished jobs
+    size_t m_done;
+    // image of the last finished job
+    fs::path m_last_filename;
+};
+
+// Load, downscale and save the image of the job
+static void Create_Image_Cache_File(const cVideo* video, const cImage_Cache_Job& job)
+{
+    SDL_Surface* sdl_surface = NULL;
+
+    if (!job.m_source.empty()) {
+        sdl_surface = IMG_Load(path_to_utf8(job.m_source).c_str());
+    }
+
+    // same fallback as cVideo::Load_Image_Helper
+    if (!sdl_surface && job.m_source != job.m_filename && job.m_settings->m_base.empty() && fs::exists(job.m_filename)) {
+        sdl_surface = IMG_Load(path_to_utf8(job.m_filename).c_str());
+    }
+
+    // failed to load image
+    if (!sdl_surface) {
+        cerr << "Error loading image : " << path_to_utf8(job.m_filename) << endl << "Reason : " << SDL_GetError() << endl;
+        return;
+    }
+
+    // create final image
+    sdl_surface = video->Convert_To_Final_Software_Image(sdl_surface);
+
+    // get final size for this resolution
+    cSize_Int size = job.m_settings->Get_Surface_Size(sdl_surface);
+    int new_width = size.m_width;
+    int new_height = size.m_height;
+
+    // apply maximum texture size
+    video->Apply_Max_Texture_Size(new_width, new_height);
+
+    // does not need to be downsampled
+    if (new_width >= sdl_surface->w && new_height >= sdl_surface->h) {
+        SDL_FreeSurface(sdl_surface);
+        return;
+    }
+
+    // calculate block reduction
+    int reduce_block_x = sdl_surface->w / new_width;
+    int reduce_block_y = sdl_surface->h / new_height;
+
+    // create downsampled image
+    unsigned int image_bpp = sdl_surface->format->BytesPerPixel;
+    unsigned char* image_downsampled = new unsigned char[new_width * new_height * image_bpp];
+    bool downsampled = video->Downscale_Image(static_cast<unsigned char*>(sdl_surface->pixels), sdl_surface->w, sdl_surface->h, image_bpp, image_downsampled, reduce_block_x, reduce_block_y);
+
+    SDL_FreeSurface(sdl_surface);
+
+    // if image is available
+    if (downsampled) {
+        video->Save_Surface(job.m_cache_filename, image_downsampled, new_width, new_height, image_bpp);
+    }
+
+    delete[] image_downsampled;
+}
+
+// Create the cache files of the queue jobs until none is left
+static void Image_Cache_Worker(cImage_Cache_Queue* queue)
+{
+    boost::unique_lock<boost::mutex> lock(queue->m_mutex);
+
+    while (queue->m_next_job < queue->m_jobs.size()) {
+        const cImage_Cache_Job& job = queue->m_jobs[queue->m_next_job];
+        queue->m_next_job++;
+
+        lock.unlock();
+        Create_Image_Cache_File(queue->m_video, job);
+        lock.lock();
+
+        queue->m_done++;
+        queue->m_last_filename = job.m_filename;
+        queue->m_condition.notify_all();
+    }
+}
+
 /* *** *** *** *** *** *** *** Video class *** *** *** *** *** *** *** *** *** *** */
 
 cVideo::cVideo(void)
@@ -53,9 +167,11 @@ cVideo::cVideo(void)
 
     m_default_buffer = GL_BACK;
     m_max_texture_size = 512;
+    m_batch_buffer = 0;
 
     m_audio_init_failed = 0;
     m_joy_init_failed = 0;
+    m_headless = 0;
     m_geometry_quality = cPreferences::m_geometry_quality_default;
     m_texture_quality = cPreferences::m_texture_quality_default;
 
@@ -64,13 +180,21 @@ cVideo::cVideo(void)
     glx_context = NULL;
 #endif
     m_render_thread = boost::thread();
+    m_render_thread_busy = 0;
+    m_render_thread_exit = 0;
+    m_render_pending = 0;
+
+    m_async_threads_started = 0;
+    m_async_threads_exit = 0;
+    m_queue_surfaces = 0;
 
     m_initialised = 0;
 }
 
 cVideo::~cVideo(void)
 {
-
+    Stop_Async_Surfaces();
+    Stop_Render_Thread();
 }
 
 void cVideo::Init_CEGUI(void) const
@@ -169,7 +293,8 @@ void cVideo::Init_CEGUI_Data(void) const
 
 void cVideo::Init_SDL(void)
 {
-    if (SDL_Init(SDL_INIT_VIDEO) == -1) {
+    // the headless mode only needs the timer
+    if (SDL_Init(m_headless ? SDL_INIT_TIMER : SDL_INIT_VIDEO) == -1) {
         cerr << "Error : SDL initialization failed" << endl << "Reason : " << SDL_GetError() << endl;
         exit(EXIT_FAILURE);
     }
@@ -202,7 +327,9 @@ void cVideo::Init_SDL(void)
 
 void cVideo::Init_Video(bool reload_textures_from_file /* = 0 */, bool use_preferences /* = 1 */)
 {
-    Render_Finish();
+    // the OpenGL context is created again
+    Finish_Async_Surfaces();
+    Stop_Render_Thread();
 
     // set the video flags
     int flags = SDL_OPENGL | SDL_SWSURFACE;
@@ -312,9 +439,9 @@ void cVideo::Init_Video(bool reload_textures_from_file /* = 0 */, bool use_prefe
     // not yet needed
     //SDL_GL_SetAttribute( SDL_GL_DEPTH_SIZE, 16 );
     SDL_GL_SetAttribute(SDL_GL_DOUBLEBUFFER, 1);
-    // if vertical synchronization is enabled
-    if (use_preferences && pPreferences->m_video_vsync) {
-        SDL_GL_SetAttribute(SDL_GL_SWAP_CONTROL, 1);
+    // vertical synchronization, also disabled again on reinitialization
+    if (use_preferences) {
+        SDL_GL_SetAttribute(SDL_GL_SWAP_CONTROL, pPreferences->m_video_vsync ? 1 : 0);
     }
 
     // if reinitialization
@@ -399,6 +526,13 @@ void cVideo::Init_Video(bool reload_textures_from_file /* = 0 */, bool use_prefe
         }
     }
 
+    // load the OpenGL extensions of the new context
+    GLenum glew_error = glewInit();
+
+    if (glew_error != GLEW_OK) {
+        cerr << "Warning : GLEW initialization failed" << endl << "Reason : " << glewGetErrorString(glew_error) << endl;
+    }
+
     // remember default buffer
     glGetIntegerv(GL_DRAW_BUFFER, &m_default_buffer);
     // get maximum texture size
@@ -533,6 +667,10 @@ void cVideo::Init_OpenGL(void)
     Init_Geometry();
     // texture detail
     Init_Texture_Detail();
+    // sprite shader
+    m_sprite_shader.Init();
+    // surface batch vertex buffer
+    Init_Batch_Buffer();
     // Resolution Scale
     Init_Resolution_Scale();
 
@@ -598,6 +736,23 @@ void cVideo::Init_Texture_Detail(void)
     }
 }
 
+void cVideo::Init_Batch_Buffer(void)
+{
+    // delete the buffer if the context was kept
+    if (m_batch_buffer && glIsBuffer(m_batch_buffer)) {
+        glDeleteBuffers(1, &m_batch_buffer);
+    }
+
+    m_batch_buffer = 0;
+
+    // vertex buffer objects are core since OpenGL 1.5
+    if (!GLEW_VERSION_1_5) {
+        return;
+    }
+
+    glGenBuffers(1, &m_batch_buffer);
+}
+
 void cVideo::Init_Resolution_Scale(void) const
 {
     // up scale
@@ -671,7 +826,9 @@ void cVideo::Init_Image_Cache(bool recreate /* = 0 */, bool draw_gui /* = 0 */)
     unsigned int loaded_files = 0;
     unsigned int file_count = image_files.size();
 
-    // create directories, load images and save to cache
+    cImage_Cache_Queue queue(this);
+
+    // create directories and the jobs of the images to cache
     for (vector<fs::path>::iterator itr = image_files.begin(); itr != image_files.end(); ++itr) {
         // get filenames
         fs::path filename = (*itr);
@@ -695,15 +852,9 @@ void cVideo::Init_Image_Cache(bool recreate /* = 0 */, bool draw_gui /* = 0 */)
             filename.replace_extension(".png");
         }
 
-        // load software image
-        cSoftware_Image software_image = Load_Image(filename);
-        SDL_Surface* sdl_surface = software_image.m_sdl_surface;
-        cImage_Settings_Data* settings = software_image.m_settings;
-
-        // failed to load image
-        if (!sdl_surface) {
-            continue;
-        }
+        // settings are parsed here as the parser is not thread safe
+        cImage_Settings_Data* settings = NULL;
+        fs::path source = Get_Image_Source(filename, 1, 0, settings);
 
         /* don't cache if no image settings or images without the width and height set
          * as there is currently no support to get the old and real image size
@@ -712,78 +863,78 @@ void cVideo::Init_Image_Cache(bool recreate /* = 0 */, bool draw_gui /* = 0 */)
         if (!settings || !settings->m_width || !settings->m_height) {
             if (settings) {
                 debug_print("Info : %s has no image settings image size set and will not get cached\n", cache_filename.c_str());
+                delete settings;
             }
             else {
                 debug_print("Info : %s has no image settings and will not get cached\n", cache_filename.c_str());
             }
-            SDL_FreeSurface(sdl_surface);
+            loaded_files++;
             continue;
         }
 
-        // create final image
-        sdl_surface = Convert_To_Final_Software_Image(sdl_surface);
-
-        // get final size for this resolution
-        cSize_Int size = settings->Get_Surface_Size(sdl_surface);
-        delete settings;
-        int new_width = size.m_width;
-        int new_height = size.m_height;
-
-        // apply maximum texture size
-        Apply_Max_Texture_Size(new_width, new_height);
-
-        // does not need to be downsampled
-        if (new_width >= sdl_surface->w && new_height >= sdl_surface->h) {
-            SDL_FreeSurface(sdl_surface);
-            continue;
+        // save as png
+        if (settings_file) {
+            cache_filename.replace_extension(".png");
         }
 
-        // calculate block reduction
-        int reduce_block_x = sdl_surface->w / new_width;
-        int reduce_block_y = sdl_surface->h / new_height;
+        cImage_Cache_Job job;
+        job.m_filename = filename;
+        job.m_source = source;
+        job.m_cache_filename = cache_filename;
+        job.m_settings = settings;
+        queue.m_jobs.push_back(job);
+    }
 
-        // create downsampled image
-        unsigned int image_bpp = sdl_surface->format->BytesPerPixel;
-        unsigned char* image_downsampled = new unsigned char[new_width * new_height * image_bpp];
-        bool downsampled = Downscale_Image(static_cast<unsigned char*>(sdl_surface->pixels), sdl_surface->w, sdl_surface->h, image_bpp, image_downsampled, reduce_block_x, reduce_block_y);
+    // load, downscale and save the images in worker threads
+    unsigned int thread_count = std::max(boost::thread::hardware_concurrency(), 1u);
+    thread_count = std::min<size_t>(thread_count, queue.m_jobs.size());
 
-        SDL_FreeSurface(sdl_surface);
+    boost::thread_group workers;
 
-        // if image is available
-        if (downsampled) {
-            // save as png
-            if (settings_file) {
-                cache_filename.replace_extension(".png");
-            }
+    for (unsigned int i = 0; i < thread_count; i++) {
+        workers.create_thread(boost::bind(&Image_Cache_Worker, &queue));
+    }
 
-            // save image
-            Save_Surface(cache_filename, image_downsampled, new_width, new_height, image_bpp);
-        }
+    {
+        boost::unique_lock<boost::mutex> lock(queue.m_mutex);
 
-        delete[] image_downsampled;
+        while (queue.m_done < queue.m_jobs.size()) {
+            queue.m_condition.wait(lock);
 
-        // count files
-        loaded_files++;
+            // draw
+            if (draw_gui) {
+                const size_t done = queue.m_done;
+#ifdef _DEBUG
+                const fs::path last_filename = queue.m_last_filename;
+#endif
+                lock.unlock();
 
-        // draw
-        if (draw_gui) {
-            // update progress
-            progress_bar->setProgress(static_cast<float>(loaded_files) / static_cast<float>(file_count));
+                // update progress
+                progress_bar->setProgress(static_cast<float>(loaded_files + done) / static_cast<float>(file_count));
 
 #ifdef _DEBUG
-            // update filename
-            cGL_Surface* surface_filename = pFont->Render_Text(pFont->m_font_small, path_to_utf8(filename), white);
-            // draw filename
-            surface_filename->Blit(game_res_w * 0.2f, game_res_h * 0.8f, 0.1f);
+                // update filename
+                cGL_Surface* surface_filename = pFont->Render_Text(pFont->m_font_small, path_to_utf8(last_filename), white);
+                // draw filename
+                surface_filename->Blit(game_res_w * 0.2f, game_res_h * 0.8f, 0.1f);
 #endif
-            Loading_Screen_Draw();
+                Loading_Screen_Draw();
 #ifdef _DEBUG
-            // delete
-            delete surface_filename;
+                // delete
+                delete surface_filename;
 #endif
+
+                lock.lock();
+            }
         }
     }
 
+    workers.join_all();
+
+    for (vector<cImage_Cache_Job>::iterator itr = queue.m_jobs.begin(); itr != queue.m_jobs.end(); ++itr) {
+        delete itr->m_settings;
+    }
+
     // set back texture detail
     m_texture_quality = real_texture_detail;
     // set directory after surfaces got loaded from Load_GL_Surface()
@@ -879,20 +1030,37 @@ void cVideo::Make_GL_Context_Inactive(void)
 
 void cVideo::Render_From_Thread(void)
 {
-    Make_GL_Context_Current();
+    boost::unique_lock<boost::mutex> lock(m_render_mutex);
+
+    while (1) {
+        // wait for the next frame
+        while (!m_render_thread_busy && !m_render_thread_exit) {
+            m_render_condition.wait(lock);
+        }
 
-    pRenderer_current->Render();
-    // under linux with sofware mesa 7.9 it only showed the rendered output with SDL_GL_SwapBuffers()
+        if (m_render_thread_exit) {
+            break;
+        }
+
+        lock.unlock();
 
-    // update performance timer
-    //pFramerate->m_perf_timer[PERF_RENDER_GAME]->Update();
+        Make_GL_Context_Current();
 
-    Make_GL_Context_Inactive();
+        pRenderer_current->Render();
+        // under linux with sofware mesa 7.9 it only showed the rendered output with SDL_GL_SwapBuffers()
+
+        Make_GL_Context_Inactive();
+
+        lock.lock();
+        m_render_thread_busy = 0;
+        m_render_condition.notify_all();
+    }
 }
 
 void cVideo::Render(bool threaded /* = 0 */)
 {
     Render_Finish();
+    Upload_Async_Surfaces(async_surface_upload_time);
 
     if (threaded) {
         pGuiSystem->renderGUI();
@@ -916,10 +1084,36 @@ void cVideo::Render(bool threaded /* = 0 */)
             pRenderer->m_render_data.clear();
         }
 
+        // the camera is updated while rendering
+        pRenderer_current->Save_Camera();
+
+        // reserve texture names for the textures created while rendering
+        if (m_texture_names.size() < render_thread_texture_names) {
+            const size_t count = m_texture_names.size();
+            m_texture_names.resize(render_thread_texture_names);
+            glGenTextures(render_thread_texture_names - count, &m_texture_names[count]);
+
+            for (size_t i = count; i < m_texture_names.size(); i++) {
+                // set highest texture id
+                if (pImage_Manager->m_high_texture_id < m_texture_names[i]) {
+                    pImage_Manager->m_high_texture_id = m_texture_names[i];
+                }
+            }
+        }
+
+        // start the render thread once
+        if (!m_render_thread.joinable()) {
+            m_render_thread = boost::thread(&cVideo::Render_From_Thread, this);
+        }
+
         // make main thread inactive
         Make_GL_Context_Inactive();
-        // start render thread
-        m_render_thread = boost::thread(&cVideo::Render_From_Thread, this);
+
+        // start rendering
+        boost::lock_guard<boost::mutex> lock(m_render_mutex);
+        m_render_thread_busy = 1;
+        m_render_pending = 1;
+        m_render_condition.notify_all();
     }
     // single thread mode
     else {
@@ -942,15 +1136,88 @@ void cVideo::Render(bool threaded /* = 0 */)
 
 void cVideo::Render_Finish(void)
 {
-#ifndef TSC_RENDER_THREAD_TEST
-    return;
-#endif
-    if (m_render_thread.joinable()) {
-        m_render_thread.join();
+    if (!m_render_pending) {
+        return;
     }
 
-    // todo : use opengl in only one thread
+    {
+        boost::unique_lock<boost::mutex> lock(m_render_mutex);
+
+        while (m_render_thread_busy) {
+            m_render_condition.wait(lock);
+        }
+    }
+
+    m_render_pending = 0;
+
     Make_GL_Context_Current();
+    Handle_Texture_Jobs();
+}
+
+void cVideo::Stop_Render_Thread(void)
+{
+    if (!m_render_thread.joinable()) {
+        return;
+    }
+
+    Render_Finish();
+
+    {
+        boost::lock_guard<boost::mutex> lock(m_render_mutex);
+        m_render_thread_exit = 1;
+        m_render_condition.notify_all();
+    }
+
+    m_render_thread.join();
+    m_render_thread_exit = 0;
+
+    // free the reserved texture names
+    if (!m_texture_names.empty()) {
+        glDeleteTextures(m_texture_names.size(), &m_texture_names[0]);
+        m_texture_names.clear();
+    }
+}
+
+void cVideo::Delete_Texture(GLuint texture_id)
+{
+    if (m_render_pending) {
+        m_texture_deletes.push_back(texture_id);
+    }
+    else if (glIsTexture(texture_id)) {
+        glDeleteTextures(1, &texture_id);
+    }
+}
+
+void cVideo::Handle_Texture_Jobs(void)
+{
+    for (vector<cTexture_Upload>::iterator itr = m_texture_uploads.begin(); itr != m_texture_uploads.end(); ++itr) {
+        cTexture_Upload& upload = (*itr);
+
+        // set SDL_image pixel store mode
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, upload.m_row_length);
+
+        glBindTexture(GL_TEXTURE_2D, upload.m_texture);
+
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        Create_GL_Texture(upload.m_width, upload.m_height, upload.m_surface->pixels, upload.m_mipmap);
+
+        // unset pixel store mode
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+
+        SDL_FreeSurface(upload.m_surface);
+    }
+
+    m_texture_uploads.clear();
+
+    for (vector<GLuint>::iterator itr = m_texture_deletes.begin(); itr != m_texture_deletes.end(); ++itr) {
+        if (glIsTexture(*itr)) {
+            glDeleteTextures(1, &(*itr));
+        }
+    }
+
+    m_texture_deletes.clear();
 }
 
 void cVideo::Toggle_Fullscreen(void)
@@ -1010,9 +1277,23 @@ cGL_Surface* cVideo :: Get_Surface_Helper(fs::path filename, bool print_errors /
     cGL_Surface* image = pImage_Manager->Get_Pointer(path_to_utf8(filename));
     // already loaded
     if (image) {
+        // still loading in the background
+        if (image->m_loading && !m_queue_surfaces) {
+            Finish_Async_Surface(image);
+        }
+
         return image;
     }
 
+    // the image settings set the size so the texture is not needed until the queue is finished
+    if (m_queue_surfaces) {
+        image = Queue_Async_Surface(filename, package, 1);
+
+        if (image) {
+            return image;
+        }
+    }
+
     // load new image
     image = Load_GL_Surface_Helper(path_to_utf8(filename), 1, print_errors, package);
     // add new image
@@ -1023,6 +1304,404 @@ cGL_Surface* cVideo :: Get_Surface_Helper(fs::path filename, bool print_errors /
     return image;
 }
 
+cGL_Surface* cVideo::Get_Surface_Async(fs::path filename)
+{
+    return Get_Surface_Async_Helper(filename, false);
+}
+
+cGL_Surface* cVideo::Get_Package_Surface_Async(fs::path filename)
+{
+    return Get_Surface_Async_Helper(filename, true);
+}
+
+cGL_Surface* cVideo::Get_Surface_Async_Helper(fs::path filename, bool package /* = true */)
+{
+    // .settings file type can't be used directly
+    if (filename.extension() == fs::path(".settings"))
+        filename.replace_extension(".png");
+
+    // pixmaps dir must be given
+    if (!filename.is_absolute()) {
+        if (package) {
+            filename = pPackage_Manager->Get_Pixmap_Reading_Path(path_to_utf8(filename), true);
+            if (filename.extension() == fs::path(".settings"))
+                filename.replace_extension(".png");
+        }
+        else {
+            filename = pResource_Manager->Get_Game_Pixmaps_Directory() / filename;
+        }
+    }
+
+    // already loaded or loading
+    cGL_Surface* image = pImage_Manager->Get_Pointer(path_to_utf8(filename));
+
+    if (image) {
+        return image;
+    }
+
+    image = Queue_Async_Surface(filename, package, 0);
+
+    // not found so load it directly to print the errors
+    if (!image) {
+        return Get_Surface_Helper(filename, true, package);
+    }
+
+    return image;
+}
+
+cGL_Surface* cVideo::Queue_Async_Surface(fs::path filename, bool package, bool require_size)
+{
+    // settings and package paths are not thread safe
+    cImage_Settings_Data* settings = NULL;
+    fs::path source = Get_Image_Source(filename, 1, package, settings);
+
+    // not found or the size is only known after loading
+    if (source.empty() || (require_size && (!settings || settings->m_width <= 0 || settings->m_height <= 0))) {
+        if (settings) {
+            delete settings;
+        }
+
+        return NULL;
+    }
+
+    // without texture until uploaded
+    cGL_Surface* image = new cGL_Surface();
+    image->m_path = filename;
+    image->m_loading = 1;
+
+    if (settings) {
+        settings->Apply(image);
+    }
+
+    pImage_Manager->Add(image);
+
+    cAsync_Surface_Job* job = new cAsync_Surface_Job();
+    job->m_surface = image;
+    job->m_state = ASYNC_SURFACE_QUEUED;
+    job->m_filename = filename;
+    job->m_source = source;
+    job->m_settings = settings;
+    job->m_sdl_surface = NULL;
+    job->m_width = 0;
+    job->m_height = 0;
+
+    boost::lock_guard<boost::mutex> lock(m_async_mutex);
+
+    // start the threads once
+    if (!m_async_threads_started) {
+        unsigned int thread_count = boost::thread::hardware_concurrency();
+        // keep one for the game
+        thread_count = thread_count > 1 ? thread_count - 1 : 1;
+        thread_count = std::min(thread_count, async_surface_max_threads);
+
+        for (unsigned int i = 0; i < thread_count; i++) {
+            m_async_threads.create_thread(boost::bind(&cVideo::Async_Surface_Worker, this));
+        }
+
+        m_async_threads_started = 1;
+    }
+
+    m_async_jobs.push_back(job);
+    m_async_condition.notify_all();
+
+    return image;
+}
+
+void cVideo::Finish_Async_Surface(cGL_Surface* surface)
+{
+    if (!surface || !surface->m_loading) {
+        return;
+    }
+
+    cAsync_Surface_Job* job = Take_Async_Surface_Job(surface);
+
+    if (job) {
+        Upload_Async_Surface(job);
+    }
+}
+
+void cVideo::Finish_Async_Surfaces(void)
+{
+    while (cAsync_Surface_Job* job = Take_Async_Surface_Job(NULL)) {
+        Upload_Async_Surface(job);
+    }
+}
+
+void cVideo::Cancel_Async_Surface(cGL_Surface* surface)
+{
+    boost::lock_guard<boost::mutex> lock(m_async_mutex);
+
+    for (vector<cAsync_Surface_Job*>::iterator itr = m_async_jobs.begin(); itr != m_async_jobs.end(); ++itr) {
+        cAsync_Surface_Job* job = (*itr);
+
+        if (job->m_surface != surface) {
+            continue;
+        }
+
+        // the thread deletes nothing so it is discarded when uploaded
+        if (job->m_state == ASYNC_SURFACE_DECODING) {
+            job->m_surface = NULL;
+            return;
+        }
+
+        if (job->m_sdl_surface) {
+            SDL_FreeSurface(job->m_sdl_surface);
+        }
+
+        delete job->m_settings;
+        delete job;
+        m_async_jobs.erase(itr);
+        return;
+    }
+}
+
+void cVideo::Stop_Async_Surfaces(void)
+{
+    {
+        boost::lock_guard<boost::mutex> lock(m_async_mutex);
+        m_async_threads_exit = 1;
+        m_async_condition.notify_all();
+    }
+
+    m_async_threads.join_all();
+
+    for (vector<cAsync_Surface_Job*>::iterator itr = m_async_jobs.begin(); itr != m_async_jobs.end(); ++itr) {
+        cAsync_Surface_Job* job = (*itr);
+
+        // stays without texture
+        if (job->m_surface) {
+            job->m_surface->m_loading = 0;
+        }
+
+        if (job->m_sdl_surface) {
+            SDL_FreeSurface(job->m_sdl_surface);
+        }
+
+        delete job->m_settings;
+        delete job;
+    }
+
+    m_async_jobs.clear();
+    m_async_threads_started = 0;
+    m_async_threads_exit = 0;
+}
+
+void cVideo::Async_Surface_Worker(void)
+{
+    boost::unique_lock<boost::mutex> lock(m_async_mutex);
+
+    while (!m_async_threads_exit) {
+        cAsync_Surface_Job* job = NULL;
+
+        for (vector<cAsync_Surface_Job*>::iterator itr = m_async_jobs.begin(); itr != m_async_jobs.end(); ++itr) {
+            if ((*itr)->m_state == ASYNC_SURFACE_QUEUED) {
+                job = (*itr);
+                break;
+            }
+        }
+
+        // wait for the next request
+        if (!job) {
+            m_async_condition.wait(lock);
+            continue;
+        }
+
+        job->m_state = ASYNC_SURFACE_DECODING;
+        lock.unlock();
+
+        Decode_Async_Surface(job);
+
+        lock.lock();
+        job->m_state = ASYNC_SURFACE_DECODED;
+        m_async_condition.notify_all();
+    }
+}
+
+void cVideo::Decode_Async_Surface(cAsync_Surface_Job* job) const
+{
+    SDL_Surface* sdl_surface = IMG_Load(path_to_utf8(job->m_source).c_str());
+
+    // same fallback as Load_Image_Helper
+    if (!sdl_surface && job->m_source != job->m_filename && (!job->m_settings || job->m_settings->m_base.empty()) && exists(job->m_filename)) {
+        sdl_surface = IMG_Load(path_to_utf8(job->m_filename).c_str());
+    }
+
+    if (!sdl_surface) {
+        return;
+    }
+
+    sdl_surface = Convert_To_Final_Software_Image(sdl_surface);
+
+    // the size given to Create_Texture by Load_GL_Surface_Helper
+    if (job->m_settings) {
+        cSize_Int size = job->m_settings->Get_Surface_Size(sdl_surface);
+        Apply_Max_Texture_Size(size.m_width, size.m_height);
+        job->m_width = size.m_width;
+        job->m_height = size.m_height;
+    }
+
+    // the texture size of Create_Texture
+    int texture_width = sdl_surface->w;
+    int texture_height = sdl_surface->h;
+
+    if (job->m_width > 0 && job->m_height > 0) {
+        texture_width = Get_Power_of_2(job->m_width);
+        texture_height = Get_Power_of_2(job->m_height);
+    }
+
+    Apply_Max_Texture_Size(texture_width, texture_height);
+
+    // downscale here instead of in Create_Texture
+    if (texture_width <= sdl_surface->w && texture_height <= sdl_surface->h && (texture_width != sdl_surface->w || texture_height != sdl_surface->h)) {
+        SDL_Surface* scaled = SDL_CreateRGBSurface(SDL_SWSURFACE, texture_width, texture_height, 32, sdl_surface->format->Rmask, sdl_surface->format->Gmask, sdl_surface->format->Bmask, sdl_surface->format->Amask);
+
+        if (scaled) {
+            Downscale_Image(static_cast<unsigned char*>(sdl_surface->pixels), sdl_surface->w, sdl_surface->h, sdl_surface->format->BytesPerPixel, static_cast<unsigned char*>(scaled->pixels), sdl_surface->w / texture_width, sdl_surface->h / texture_height);
+            SDL_FreeSurface(sdl_surface);
+            sdl_surface = scaled;
+        }
+    }
+
+    job->m_sdl_surface = sdl_surface;
+}
+
+void cVideo::Upload_Async_Surface(cAsync_Surface_Job* job)
+{
+    // surface was deleted
+    if (!job->m_surface) {
+        if (job->m_sdl_surface) {
+            SDL_FreeSurface(job->m_sdl_surface);
+        }
+
+        delete job->m_settings;
+        delete job;
+        return;
+    }
+
+    cGL_Surface* image = NULL;
+
+    if (job->m_sdl_surface) {
+        // images of the same directory share atlas pages
+        const std::string atlas_group = path_to_utf8(job->m_filename.parent_path());
+
+        if (job->m_settings) {
+            image = Create_Texture(job->m_sdl_surface, job->m_settings->m_mipmap, job->m_width, job->m_height, atlas_group);
+            job->m_settings->Apply(image);
+        }
+        else {
+            image = Create_Texture(job->m_sdl_surface, 0, 0, 0, atlas_group);
+        }
+    }
+    else {
+        cerr << "Error loading image : " << path_to_utf8(job->m_filename) << endl;
+    }
+
+    if (image) {
+#ifdef TSC_ASYNC_SURFACE_CHECK
+        const cGL_Surface* placeholder = job->m_surface;
+
+        // Get_Surface hands out placeholders with a size as final
+        if (placeholder->m_start_w > 0.0f && placeholder->m_start_h > 0.0f &&
+            (placeholder->m_start_w != image->m_start_w || placeholder->m_start_h != image->m_start_h ||
+             placeholder->m_w != image->m_w || placeholder->m_h != image->m_h ||
+             placeholder->m_col_w != image->m_col_w || placeholder->m_col_h != image->m_col_h ||
+             placeholder->m_col_pos.m_x != image->m_col_pos.m_x || placeholder->m_col_pos.m_y != image->m_col_pos.m_y ||
+             placeholder->m_int_x != image->m_int_x || placeholder->m_int_y != image->m_int_y)) {
+            cerr << "Warning : Async surface " << path_to_utf8(job->m_filename) << " changed its size when uploaded from "
+                 << placeholder->m_start_w << "x" << placeholder->m_start_h << " to " << image->m_start_w << "x" << image->m_start_h << endl;
+        }
+#endif
+        job->m_surface->Take_Texture(image);
+        delete image;
+
+#ifdef TSC_ASYNC_SURFACE_CHECK
+        if (!job->m_surface->m_image && !m_headless) {
+            cerr << "Warning : Async surface " << path_to_utf8(job->m_filename) << " has no texture after the upload" << endl;
+        }
+#endif
+    }
+
+    job->m_surface->m_loading = 0;
+    // static sprites using it can be cached now
+    cStatic_Layer::Image_Loaded();
+
+    delete job->m_settings;
+    delete job;
+}
+
+void cVideo::Upload_Async_Surfaces(float max_time)
+{
+    const boost::chrono::high_resolution_clock::time_point start = boost::chrono::high_resolution_clock::now();
+
+    while (1) {
+        cAsync_Surface_Job* job = NULL;
+
+        {
+            boost::lock_guard<boost::mutex> lock(m_async_mutex);
+
+            for (vector<cAsync_Surface_Job*>::iterator itr = m_async_jobs.begin(); itr != m_async_jobs.end(); ++itr) {
+                if ((*itr)->m_state == ASYNC_SURFACE_DECODED) {
+                    job = (*itr);
+                    m_async_jobs.erase(itr);
+                    break;
+                }
+            }
+        }
+
+        if (!job) {
+            break;
+        }
+
+        Upload_Async_Surface(job);
+
+        const boost::chrono::duration<float, boost::milli> elapsed = boost::chrono::high_resolution_clock::now() - start;
+
+        if (elapsed.count() >= max_time) {
+            break;
+        }
+    }
+}
+
+cVideo::cAsync_Surface_Job* cVideo::Take_Async_Surface_Job(const cGL_Surface* surface)
+{
+    boost::unique_lock<boost::mutex> lock(m_async_mutex);
+
+    // NULL takes the first job
+    vector<cAsync_Surface_Job*>::iterator itr = m_async_jobs.begin();
+
+    if (surface) {
+        while (itr != m_async_jobs.end() && (*itr)->m_surface != surface) {
+            ++itr;
+        }
+    }
+
+    if (itr == m_async_jobs.end()) {
+        return NULL;
+    }
+
+    cAsync_Surface_Job* job = (*itr);
+
+    // not started yet
+    if (job->m_state == ASYNC_SURFACE_QUEUED) {
+        job->m_state = ASYNC_SURFACE_DECODING;
+        lock.unlock();
+
+        Decode_Async_Surface(job);
+
+        lock.lock();
+        job->m_state = ASYNC_SURFACE_DECODED;
+    }
+
+    // decoded by a thread
+    while (job->m_state != ASYNC_SURFACE_DECODED) {
+        m_async_condition.wait(lock);
+    }
+
+    m_async_jobs.erase(std::find(m_async_jobs.begin(), m_async_jobs.end(), job));
+
+    return job;
+}
+
 cVideo::cSoftware_Image cVideo::Load_Image(boost::filesystem::path filename, bool load_settings /* = 1 */, bool print_errors /* = 1 */) const
 {
     return Load_Image_Helper(filename, load_settings, print_errors, 0);
@@ -1035,6 +1714,43 @@ cVideo::cSoftware_Image cVideo :: Load_Package_Image(boost::filesystem::path fil
 
 cVideo::cSoftware_Image cVideo :: Load_Image_Helper(boost::filesystem::path filename, bool load_settings /* = 1 */, bool print_errors /* = 1 */, bool package /* = 1 */) const
 {
+    cSoftware_Image software_image = cSoftware_Image();
+    SDL_Surface* sdl_surface = NULL;
+    cImage_Settings_Data* settings = NULL;
+
+    fs::path source = Get_Image_Source(filename, load_settings, package, settings);
+
+    if (!source.empty()) {
+        sdl_surface = IMG_Load(path_to_utf8(source).c_str());
+    }
+
+    // if the cached image failed to load
+    if (!sdl_surface && source != filename && (!settings || settings->m_base.empty()) && exists(filename)) {
+        sdl_surface = IMG_Load(path_to_utf8(filename).c_str());
+    }
+
+    if (!sdl_surface) {
+        if (settings) {
+            delete settings;
+            settings = NULL;
+        }
+
+        if (print_errors) {
+            cerr << "Error loading image : " << path_to_utf8(filename) << endl << "Reason : " << SDL_GetError() << endl;
+        }
+
+        return software_image;
+    }
+
+    software_image.m_sdl_surface = sdl_surface;
+    software_image.m_settings = settings;
+    return software_image;
+}
+
+fs::path cVideo::Get_Image_Source(fs::path& filename, bool load_settings, bool package, cImage_Settings_Data*& settings) const
+{
+    settings = NULL;
+
     // pixmaps dir must be given
     if (!filename.is_absolute()) {
         if (package) {
@@ -1047,10 +1763,6 @@ cVideo::cSoftware_Image cVideo :: Load_Image_Helper(boost::filesystem::path file
         }
     }
 
-    cSoftware_Image software_image = cSoftware_Image();
-    SDL_Surface* sdl_surface = NULL;
-    cImage_Settings_Data* settings = NULL;
-
     // load settings if available
     if (load_settings) {
         fs::path settings_file = fs::path(filename);
@@ -1059,7 +1771,7 @@ cVideo::cSoftware_Image cVideo :: Load_Image_Helper(boost::filesystem::path file
         if (settings_file.extension() != fs::path(".settings"))
             settings_file.replace_extension(".settings");
 
-        if (fs::exists(settings_file) && fs::is_regular_file(settings_file)) {
+        if (fs::is_regular_file(settings_file)) {
             settings = pSettingsParser->Get(settings_file);
 
             // With packages support, an image loaded from a user path would have a relative path
@@ -1074,8 +1786,8 @@ cVideo::cSoftware_Image cVideo :: Load_Image_Helper(boost::filesystem::path file
                 img_filename_cache = m_imgcache_dir / rel; // Why add .png here? Should be in the return value of fs::relative() anyway.
 
             // check if image cache file exists
-            if (!img_filename_cache.empty() && fs::exists(img_filename_cache) && fs::is_regular_file(img_filename_cache))
-                sdl_surface = IMG_Load(path_to_utf8(img_filename_cache).c_str());
+            if (!img_filename_cache.empty() && fs::is_regular_file(img_filename_cache))
+                return img_filename_cache;
             // image given in base settings
             else if (!settings->m_base.empty()) {
                 // use current directory
@@ -1092,32 +1804,17 @@ cVideo::cSoftware_Image cVideo :: Load_Image_Helper(boost::filesystem::path file
                         img_filename = fs::absolute(img_filename, pResource_Manager->Get_Game_Pixmaps_Directory());
                 }
 
-                sdl_surface = IMG_Load(path_to_utf8(img_filename).c_str());
+                return img_filename;
             }
         }
     }
 
     // if not set in image settings and file exists
-    if (!sdl_surface && exists(filename) && (!settings || settings->m_base.empty())) {
-        sdl_surface = IMG_Load(path_to_utf8(filename).c_str());
-    }
-
-    if (!sdl_surface) {
-        if (settings) {
-            delete settings;
-            settings = NULL;
-        }
-
-        if (print_errors) {
-            cerr << "Error loading image : " << path_to_utf8(filename) << endl << "Reason : " << SDL_GetError() << endl;
-        }
-
-        return software_image;
+    if (exists(filename) && (!settings || settings->m_base.empty())) {
+        return filename;
     }
 
-    software_image.m_sdl_surface = sdl_surface;
-    software_image.m_settings = settings;
-    return software_image;
+    return fs::path();
 }
 
 cGL_Surface* cVideo::Load_GL_Surface(boost::filesystem::path filename, bool use_settings /* = 1 */, bool print_errors /* = 1 */)
@@ -1150,6 +1847,8 @@ cGL_Surface* cVideo :: Load_GL_Surface_Helper(boost::filesystem::path filename,
     cSoftware_Image software_image = Load_Image_Helper(filename, use_settings, print_errors, package);
     SDL_Surface* sdl_surface = software_image.m_sdl_surface;
     cImage_Settings_Data* settings = software_image.m_settings;
+    // images of the same directory share atlas pages
+    const std::string atlas_group = path_to_utf8(filename.parent_path());
 
     // final surface
     cGL_Surface* image = NULL;
@@ -1160,14 +1859,14 @@ cGL_Surface* cVideo :: Load_GL_Surface_Helper(boost::filesystem::path filename,
         cSize_Int size = settings->Get_Surface_Size(sdl_surface);
         Apply_Max_Texture_Size(size.m_width, size.m_height);
         // get basic settings surface
-        image = pVideo->Create_Texture(sdl_surface, settings->m_mipmap, size.m_width, size.m_height);
+        image = pVideo->Create_Texture(sdl_surface, settings->m_mipmap, size.m_width, size.m_height, atlas_group);
         // apply settings
         settings->Apply(image);
         delete settings;
     }
     // without settings
     else {
-        image = Create_Texture(sdl_surface);
+        image = Create_Texture(sdl_surface, 0, 0, 0, atlas_group);
     }
     // set filename
     if (image) {
@@ -1210,7 +1909,7 @@ SDL_Surface* cVideo::Convert_To_Final_Software_Image(SDL_Surface* surface) const
     return surface;
 }
 
-cGL_Surface* cVideo::Create_Texture(SDL_Surface* surface, bool mipmap /* = 0 */, unsigned int force_width /* = 0 */, unsigned int force_height /* = 0 */) const
+cGL_Surface* cVideo::Create_Texture(SDL_Surface* surface, bool mipmap /* = 0 */, unsigned int force_width /* = 0 */, unsigned int force_height /* = 0 */, const std::string& atlas_group /* = "" */)
 {
     if (!surface) {
         return NULL;
@@ -1219,25 +1918,16 @@ cGL_Surface* cVideo::Create_Texture(SDL_Surface* surface, bool mipmap /* = 0 */,
     // create final image
     surface = Convert_To_Final_Software_Image(surface);
 
-    /* todo : Make this a render request because it forces an early thread render finish as opengl commands are used directly.
-     * Reduces performance if the render thread is on. It's usually called from the text rendering in cTimeDisplay::Update.
+    /* Upload in Render_Finish if the render thread is active and a texture name is reserved.
+     * It's usually called from the text rendering in cTimeDisplay::Update.
+     * Atlas pages are changed directly and need the OpenGL context.
     */
-    pVideo->Render_Finish();
-
-    // create one texture
-    GLuint image_num = 0;
-    glGenTextures(1, &image_num);
+    const bool upload_later = m_render_pending && atlas_group.empty() && !m_texture_names.empty();
+    // only the size is used without an OpenGL context
+    const bool upload = !m_headless;
 
-    // if image id is 0 it failed
-    if (!image_num) {
-        cerr << "Error : GL image generation failed" << endl;
-        SDL_FreeSurface(surface);
-        return NULL;
-    }
-
-    // set highest texture id
-    if (pImage_Manager->m_high_texture_id < image_num) {
-        pImage_Manager->m_high_texture_id = image_num;
+    if (!upload_later) {
+        Render_Finish();
     }
 
     int width = surface->w;
@@ -1262,6 +1952,9 @@ cGL_Surface* cVideo::Create_Texture(SDL_Surface* surface, bool mipmap /* = 0 */,
     // check if the image size is greater than the maximum texture size
     Apply_Max_Texture_Size(texture_width, texture_height);
 
+    // pixels per row of the image data
+    unsigned int row_length = surface->pitch / surface->format->BytesPerPixel;
+
     // scale to new size
     if (texture_width != surface->w || texture_height != surface->h) {
         int reduce_block_x = surface->w / texture_width;
@@ -1272,31 +1965,77 @@ cGL_Surface* cVideo::Create_Texture(SDL_Surface* surface, bool mipmap /* = 0 */,
         Downscale_Image(static_cast<unsigned char*>(surface->pixels), surface->w, surface->h, surface->format->BytesPerPixel, new_pixels, reduce_block_x, reduce_block_y);
         SDL_free(surface->pixels);
         surface->pixels = new_pixels;
+        row_length = texture_width;
     }
-    // set SDL_image pixel store mode
-    else {
-        glPixelStorei(GL_UNPACK_ROW_LENGTH, surface->pitch / surface->format->BytesPerPixel);
+
+    GLuint image_num = 0;
+    GL_rect tex_coords(0.0f, 0.0f, 1.0f, 1.0f);
+    bool atlas = 0;
+
+    // small images share an atlas page with the other images of the group
+    if (upload && !mipmap && !atlas_group.empty()) {
+        atlas = pImage_Manager->m_texture_atlas.Add(atlas_group, texture_width, texture_height, surface->pixels, row_length, image_num, tex_coords);
     }
 
-    // use the generated texture
-    glBindTexture(GL_TEXTURE_2D, image_num);
+    if (upload_later) {
+        image_num = m_texture_names.back();
+        m_texture_names.pop_back();
 
-    // set texture wrap modes which control how to interpret texture coordinates
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    // set texture magnification function
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    // upload to OpenGL texture
-    Create_GL_Texture(texture_width, texture_height, surface->pixels, mipmap);
+        cTexture_Upload upload;
+        upload.m_texture = image_num;
+        upload.m_surface = surface;
+        upload.m_width = texture_width;
+        upload.m_height = texture_height;
+        upload.m_row_length = row_length;
+        upload.m_mipmap = mipmap;
+        m_texture_uploads.push_back(upload);
 
-    // unset pixel store mode
-    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+        // freed after the upload
+        surface = NULL;
+    }
+    else if (upload && !atlas) {
+        // create one texture
+        glGenTextures(1, &image_num);
+
+        // if image id is 0 it failed
+        if (!image_num) {
+            cerr << "Error : GL image generation failed" << endl;
+            SDL_FreeSurface(surface);
+            return NULL;
+        }
+
+        // set highest texture id
+        if (pImage_Manager->m_high_texture_id < image_num) {
+            pImage_Manager->m_high_texture_id = image_num;
+        }
+
+        // set SDL_image pixel store mode
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, row_length);
 
-    SDL_FreeSurface(surface);
+        // use the generated texture
+        glBindTexture(GL_TEXTURE_2D, image_num);
+
+        // set texture wrap modes which control how to interpret texture coordinates
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        // set texture magnification function
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        // upload to OpenGL texture
+        Create_GL_Texture(texture_width, texture_height, surface->pixels, mipmap);
+
+        // unset pixel store mode
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+    }
+
+    if (surface) {
+        SDL_FreeSurface(surface);
+    }
 
     // create OpenGL surface class
     cGL_Surface* image = new cGL_Surface();
     image->m_image = image_num;
+    image->m_tex_coords = tex_coords;
+    image->m_atlas = atlas;
     image->m_tex_w = texture_width;
     image->m_tex_h = texture_height;
     image->m_start_w = static_cast<float>(width);
@@ -1309,7 +2048,7 @@ cGL_Surface* cVideo::Create_Texture(SDL_Surface* surface, bool mipmap /* = 0 */,
     // if debug build check for errors
 #ifdef _DEBUG
     // glGetError only saves one error flag
-    GLenum error = glGetError();
+    GLenum error = upload ? glGetError() : GL_NO_ERROR;
 
     if (error != GL_NO_ERROR) {
         cerr << "CreateTexture : GL Error found : " << gluErrorString(error) << endl;
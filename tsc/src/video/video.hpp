@@ -20,6 +20,7 @@
 #include "../core/global_basic.hpp"
 #include "../core/global_game.hpp"
 #include "../video/color.hpp"
+#include "../video/sprite_shader.hpp"
 
 namespace TSC {
 
@@ -73,6 +74,8 @@ namespace TSC {
         void Init_Geometry(void);
         // Initialize Texture detail settings
         void Init_Texture_Detail(void);
+        // Create the streaming vertex buffer of the surface batches if supported
+        void Init_Batch_Buffer(void);
         // initialize the up/down scaling value for the current resolution ( image/mouse scale )
         void Init_Resolution_Scale(void) const;
         /* Initialize the image cache and recreates cache if game version changed
@@ -98,23 +101,60 @@ namespace TSC {
         // make the opengl context inactive for the current thread
         void Make_GL_Context_Inactive(void);
 
-        // Render. Should be called from a thread
+        // Render loop of the render thread
         void Render_From_Thread(void);
-        // Render game, GUI and swap the opengl buffer
+        /* Render game, GUI and swap the opengl buffer
+         * threaded : if set the game is rendered in the render thread and this returns
+         * without waiting. The main thread has no OpenGL context until Render_Finish.
+        */
         void Render(bool threaded = 0);
-        // Finish thread rendering
+        /* Finish thread rendering
+         * must be called before using OpenGL functions outside of the render queue
+        */
         void Render_Finish(void);
+        // Finish rendering and stop the render thread
+        void Stop_Render_Thread(void);
+        // Return true if the render thread has the OpenGL context
+        inline bool Is_Render_Pending(void) const
+        {
+            return m_render_pending;
+        };
+        /* Delete the texture
+         * if the render thread is active it is deleted in Render_Finish
+        */
+        void Delete_Texture(GLuint texture_id);
 
         // Toggle fullscreen video mode ( new mode is set to preferences )
         void Toggle_Fullscreen(void);
 
         /* Check if the image was already loaded and returns a pointer to it else it will be loaded
+         * If m_queue_surfaces is set and the image settings set the size the image is loaded
+         * in the background like with Get_Surface_Async as the placeholder already has the final size.
+         * Otherwise it waits until the image is loaded.
          * The returned image should not be deleted or modified.
          */
         cGL_Surface* Get_Surface(boost::filesystem::path filename, bool print_errors = true);
         cGL_Surface* Get_Package_Surface(boost::filesystem::path filename, bool print_errors = true);
         cGL_Surface* Get_Surface_Helper(boost::filesystem::path filename, bool print_errors = true, bool package = true);
 
+        /* Return the image and load it in background threads if not already loaded
+         * Until it is uploaded in Render the returned image has no texture and only
+         * the size and settings from the image settings file.
+         * Finish_Async_Surface and Get_Surface wait for it to be loaded.
+         * The returned image should not be deleted or modified.
+         */
+        cGL_Surface* Get_Surface_Async(boost::filesystem::path filename);
+        cGL_Surface* Get_Package_Surface_Async(boost::filesystem::path filename);
+        cGL_Surface* Get_Surface_Async_Helper(boost::filesystem::path filename, bool package = true);
+        // Wait until the image is loaded in the background and upload it
+        void Finish_Async_Surface(cGL_Surface* surface);
+        // Wait until all images are loaded in the background and upload them
+        void Finish_Async_Surfaces(void);
+        // Stop loading the image of the deleted surface
+        void Cancel_Async_Surface(cGL_Surface* surface);
+        // Stop the background loading threads and discard the images not yet uploaded
+        void Stop_Async_Surfaces(void);
+
         // Software image
         class cSoftware_Image {
         public:
@@ -136,6 +176,11 @@ namespace TSC {
         cSoftware_Image Load_Image(boost::filesystem::path filename, bool load_settings = 1, bool print_errors = 1) const;
         cSoftware_Image Load_Package_Image(boost::filesystem::path filename, bool load_settings = 1, bool print_errors = 1) const;
         cSoftware_Image Load_Image_Helper(boost::filesystem::path filename, bool load_settings = 1, bool print_errors = 1, bool package = 1) const;
+        /* Return the file the image is loaded from or an empty path if not found
+         * filename : the image which is set to the absolute path
+         * settings : set to the image settings if loaded and found which should be deleted if not used anymore
+        */
+        boost::filesystem::path Get_Image_Source(boost::filesystem::path& filename, bool load_settings, bool package, cImage_Settings_Data*& settings) const;
 
         /* Load and return the hardware image
          * use_settings : enable file settings if set to 1
@@ -154,11 +199,13 @@ namespace TSC {
         SDL_Surface* Convert_To_Final_Software_Image(SDL_Surface* surface) const;
 
         /* Convert a SDL_Surface to a GL image
+         * if the render thread is active the upload is done in Render_Finish
          * surface : the source SDL_surface which will be auto-deleted.
          * mipmap : create texture mipmaps
          * force_width/height : force the given width and height
+         * atlas_group : if set the image can be added to a texture atlas page of this group
         */
-        cGL_Surface* Create_Texture(SDL_Surface* surface, bool mipmap = 0, unsigned int force_width = 0, unsigned int force_height = 0) const;
+        cGL_Surface* Create_Texture(SDL_Surface* surface, bool mipmap = 0, unsigned int force_width = 0, unsigned int force_height = 0, const std::string& atlas_group = "");
 
         /* Copy pixels to the bound GL texture
          * mipmap : create texture mipmaps
@@ -218,11 +265,25 @@ namespace TSC {
         GLint m_default_buffer;
         // max texture size
         GLint m_max_texture_size;
+        // shader used for batched sprites if supported
+        cSprite_Shader m_sprite_shader;
+        /* streaming vertex buffer of the render queue surface batches
+         * 0 if not supported and the batches use client vertex arrays
+        */
+        GLuint m_batch_buffer;
 
         // if audio initialization failed
         bool m_audio_init_failed;
         // if joystick initialization failed
         bool m_joy_init_failed;
+        /* no window and no OpenGL context
+         * set before Init_SDL, images are loaded without a texture
+        */
+        bool m_headless;
+        /* if set Get_Surface loads new images with a known size in the background
+         * Finish_Async_Surfaces must be called before the images are drawn
+        */
+        bool m_queue_surfaces;
 
         // active image cache directory
         boost::filesystem::path m_imgcache_dir;
@@ -242,6 +303,87 @@ namespace TSC {
         boost::thread m_render_thread;
 
     private:
+        // texture data uploaded after the render thread finished
+        struct cTexture_Upload {
+            GLuint m_texture;
+            SDL_Surface* m_surface;
+            unsigned int m_width;
+            unsigned int m_height;
+            unsigned int m_row_length;
+            bool m_mipmap;
+        };
+
+        // Upload and delete the textures used while the render thread was active
+        void Handle_Texture_Jobs(void);
+
+        // guards the render thread state
+        boost::mutex m_render_mutex;
+        boost::condition_variable m_render_condition;
+        // set if the render thread should render pRenderer_current
+        bool m_render_thread_busy;
+        // set if the render thread should exit
+        bool m_render_thread_exit;
+        // set if a frame was given to the render thread and not finished
+        bool m_render_pending;
+
+        // texture names reserved for uploads while the render thread is active
+        vector<GLuint> m_texture_names;
+        vector<cTexture_Upload> m_texture_uploads;
+        vector<GLuint> m_texture_deletes;
+
+        enum Async_Surface_State {
+            ASYNC_SURFACE_QUEUED,
+            ASYNC_SURFACE_DECODING,
+            ASYNC_SURFACE_DECODED
+        };
+
+        // image loaded in the background
+        struct cAsync_Surface_Job {
+            // surface waiting for the texture or NULL if it was deleted
+            cGL_Surface* m_surface;
+            Async_Surface_State m_state;
+            // image path
+            boost::filesystem::path m_filename;
+            // file the image is loaded from
+            boost::filesystem::path m_source;
+            cImage_Settings_Data* m_settings;
+            // decoded image in the texture size or NULL if it failed
+            SDL_Surface* m_sdl_surface;
+            // size given to Create_Texture
+            int m_width;
+            int m_height;
+        };
+
+        /* Create the image without texture and queue loading it in the background
+         * require_size : only if the image settings set the size
+         * returns NULL if the image file is not found or the size is not known
+        */
+        cGL_Surface* Queue_Async_Surface(boost::filesystem::path filename, bool package, bool require_size);
+        // Decode images until the threads are stopped
+        void Async_Surface_Worker(void);
+        // Load the image of the job and scale it to the texture size
+        void Decode_Async_Surface(cAsync_Surface_Job* job) const;
+        // Create the texture of the decoded job and delete the job
+        void Upload_Async_Surface(cAsync_Surface_Job* job);
+        // Upload the decoded images until the given milliseconds are used
+        void Upload_Async_Surfaces(float max_time);
+        /* Take the job of the surface out of the queue and decode it if needed
+         * returns NULL if there is no job for the surface
+        */
+        cAsync_Surface_Job* Take_Async_Surface_Job(const cGL_Surface* surface);
+
+        // guards the background loading jobs
+        boost::mutex m_async_mutex;
+        boost::condition_variable m_async_condition;
+        // background loading threads
+        boost::thread_group m_async_threads;
+        // set if the background loading threads are started
+        bool m_async_threads_started;
+        // set if the background loading threads should exit
+        bool m_async_threads_exit;
+        // background loading jobs in order of the requests
+        vector<cAsync_Surface_Job*> m_async_jobs;
+
         // if set video is initialized successfully
         bool m_initialised;
     };